@@ -509,6 +509,7 @@ typedef struct ai_info {
 														// on a bigship.   SCAN_FIGHTERS_INTERVAL is defined in AiBig.h
 	int		choose_enemy_timestamp;			//	Time at which it is next legal to choose a new enemy (does not apply 
 														// to special situations, like getting hit by a weapon)
+	int		find_enemy_timestamp;			//	Time at which a ship with no target may search for one again (see ai_lod_find_enemy_delay)
 	int		force_warp_time;					//	time at which to give up avoiding a ship and just warp out
 
 	int		shockwave_object;					//	Object index of missile that will generate a shockwave.  We will try to avoid.
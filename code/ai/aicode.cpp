@@ -1712,6 +1712,38 @@ int num_enemies_attacking(int objnum)
 	return count;
 }
 
+/**
+ * Same as num_enemies_attacking(), but for every object in one pass over the ships.
+ * counts must have room for MAX_OBJECTS entries.
+ */
+static void num_enemies_attacking_all(int *counts)
+{
+	object		*objp;
+	ship			*sp;
+	ship_subsys	*ssp;
+	ship_obj		*so;
+	int			target_objnum;
+
+	memset(counts, 0, MAX_OBJECTS * sizeof(int));
+
+	for ( so = GET_FIRST(&Ship_obj_list); so != END_OF_LIST(&Ship_obj_list); so = GET_NEXT(so) ) {
+		objp = &Objects[so->objnum];
+		Assert(objp->instance != -1);
+		sp = &Ships[objp->instance];
+
+		target_objnum = Ai_info[sp->ai_index].target_objnum;
+		if ( (target_objnum >= 0) && (target_objnum < MAX_OBJECTS) )
+			counts[target_objnum]++;
+
+		if ( Ship_info[sp->ship_info_index].flags & SIF_BIG_SHIP ) {
+			for ( ssp = GET_FIRST(&sp->subsys_list); ssp != END_OF_LIST(&sp->subsys_list); ssp = GET_NEXT(ssp) ) {
+				if ( (ssp->system_info->type == SUBSYSTEM_TURRET) && (ssp->turret_enemy_objnum >= 0) && (ssp->turret_enemy_objnum < MAX_OBJECTS) && (ssp->current_hits > 0) )
+					counts[ssp->turret_enemy_objnum]++;
+			}
+		}
+	}
+}
+
 /**
  * Scan all the ships in *objp's wing. Return the lowest maximum speed of a ship in the wing.
  *
@@ -1847,8 +1879,13 @@ typedef struct eval_nearest_objnum {
 	int	nearest_objnum;
 	float	nearest_dist;
 	int	check_danger_weapon_objnum;
+	int	*num_attacking;			//	attacker count per object, filled in the first time it's needed
 } eval_nearest_objnum;
 
+//	Nothing changes who is attacking whom while get_nearest_objnum() looks at candidates,
+//	so the counts are taken once per search instead of once per candidate.
+static int Nearest_objnum_attackers[MAX_OBJECTS];
+
 
 void evaluate_object_as_nearest_objnum(eval_nearest_objnum *eno)
 {
@@ -1924,7 +1961,11 @@ void evaluate_object_as_nearest_objnum(eval_nearest_objnum *eno)
 					dist = dist * 0.5f;
 				}
 
-				num_attacking = num_enemies_attacking(eno->trial_objp-Objects);
+				if (eno->num_attacking == NULL) {
+					eno->num_attacking = Nearest_objnum_attackers;
+					num_enemies_attacking_all(eno->num_attacking);
+				}
+				num_attacking = eno->num_attacking[eno->trial_objp-Objects];
 				if ((sip->flags & (SIF_BIG_SHIP | SIF_HUGE_SHIP)) || (num_attacking < eno->max_attackers)) {
 					if (!(sip->flags & (SIF_BIG_SHIP | SIF_HUGE_SHIP))){
 						dist *= (float) (num_attacking+2)/2.0f;				//	prevents lots of ships from attacking same target
@@ -1977,6 +2018,7 @@ int get_nearest_objnum(int objnum, int enemy_team_mask, int enemy_wing, float ra
 	eno.nearest_dist = range;
 	eno.nearest_objnum = -1;
 	eno.check_danger_weapon_objnum = 0;
+	eno.num_attacking = NULL;
 
 	// go through the list of all ships and evaluate as potential targets
 	for ( so = GET_FIRST(&Ship_obj_list); so != END_OF_LIST(&Ship_obj_list); so = GET_NEXT(so) ) {
@@ -13589,6 +13631,39 @@ void validate_mode_submode(ai_info *aip)
 	}
 }
 
+// AI level of detail.  A ship with nothing to attack calls find_enemy() every frame, which walks
+// every object in the mission; ships far from the player can afford to look less often.
+// Turn this off to make target acquisition independent of where the player is.
+int Ai_lod_enabled = 1;
+DCF_BOOL( ai_lod, Ai_lod_enabled )
+
+MONITOR( NumFindEnemyCalls )
+MONITOR( NumFindEnemyDeferred )
+
+#define AI_LOD_NEAR_DIST		2000.0f		//	Ships closer than this to the player always search every frame
+#define AI_LOD_MAX_DELAY		1000		//	Longest wait between searches, in milliseconds
+
+/**
+ * How long a ship that just failed to find an enemy should wait before trying again.
+ * Based on distance to the player, with no delay for ships the player is likely watching.
+ */
+static int ai_lod_find_enemy_delay(object *objp, ship *shipp)
+{
+	float	dist;
+
+	if ( !Ai_lod_enabled || (Game_mode & GM_MULTIPLAYER) || (Player_obj == NULL) || (Player_ai == NULL) )
+		return 0;
+
+	if ( (Player_ai->target_objnum == OBJ_INDEX(objp)) || (shipp->flags & (SF_ESCORT | SF_FROM_PLAYER_WING)) )
+		return 0;
+
+	dist = vm_vec_dist_quick(&objp->pos, &Player_obj->pos);
+	if (dist < AI_LOD_NEAR_DIST)
+		return 0;
+
+	return MIN((int) (dist / AI_LOD_NEAR_DIST) * 125, AI_LOD_MAX_DELAY);
+}
+
 /**
  * Process AI object "objnum".
  */
@@ -13675,12 +13750,19 @@ void ai_frame(int objnum)
 		} else if (aip->resume_goal_time == -1) {
 			// AL 12-9-97: Don't allow cargo and navbuoys to set their aip->target_objnum
 			if ( Ship_info[shipp->ship_info_index].class_type > -1 && (Ship_types[Ship_info[shipp->ship_info_index].class_type].ai_bools & STI_AI_AUTO_ATTACKS) ) {
-				target_objnum = find_enemy(objnum, MAX_ENEMY_DISTANCE, The_mission.ai_profile->max_attackers[Game_skill_level]);		//	Attack up to 25K units away.
-				if (target_objnum != -1) {
-					if (aip->target_objnum != target_objnum)
-						aip->aspect_locked_time = 0.0f;
-					set_target_objnum(aip, target_objnum);
-					En_objp = &Objects[target_objnum];
+				if ( timestamp_elapsed(aip->find_enemy_timestamp) ) {
+					MONITOR_INC( NumFindEnemyCalls, 1 );
+					target_objnum = find_enemy(objnum, MAX_ENEMY_DISTANCE, The_mission.ai_profile->max_attackers[Game_skill_level]);		//	Attack up to 25K units away.
+					if (target_objnum != -1) {
+						if (aip->target_objnum != target_objnum)
+							aip->aspect_locked_time = 0.0f;
+						set_target_objnum(aip, target_objnum);
+						En_objp = &Objects[target_objnum];
+					} else {
+						aip->find_enemy_timestamp = timestamp(ai_lod_find_enemy_delay(Pl_objp, shipp));
+					}
+				} else {
+					MONITOR_INC( NumFindEnemyDeferred, 1 );
 				}
 			}
 		}
@@ -13850,6 +13932,8 @@ void ai_control_info_check( object *obj, ai_info *aip )
 
 int Last_ai_obj = -1;
 
+MONITOR( AiFrameMicroseconds )
+
 void ai_process( object * obj, int ai_index, float frametime )
 {
 	if (obj->flags & OF_SHOULD_BE_DEAD)
@@ -13872,8 +13956,14 @@ void ai_process( object * obj, int ai_index, float frametime )
 
 	memset( &AI_ci, 0, sizeof(AI_ci) );
 
+#ifndef NDEBUG
+	int start_usec = timer_get_microseconds();
+#endif
+
 	ai_frame(OBJ_INDEX(obj));
 
+	MONITOR_INC( AiFrameMicroseconds, timer_get_microseconds() - start_usec );
+
 	AI_ci.pitch = 0.0f;
 	AI_ci.bank = 0.0f;
 	AI_ci.heading = 0.0f;
@@ -14051,6 +14141,7 @@ void init_ai_object(int objnum)
 	aip->scan_for_enemy_timestamp = timestamp(1);
 
 	aip->choose_enemy_timestamp = timestamp(3*(NUM_SKILL_LEVELS-Game_skill_level) * ((static_rand_alt() % 500) + 500));
+	aip->find_enemy_timestamp = timestamp(1);
 
 	aip->shockwave_object = -1;
 	aip->shield_manage_timestamp = timestamp(1);
@@ -520,6 +520,29 @@ int valid_turret_enemy(object *objp, object *turret_parent)
 }
 
 extern int Player_attacking_enabled;
+// All the turrets on a ship ask whether the same candidates can be seen through nebula and AWACS,
+// and the answer only depends on the parent ship, so it is worked out once per ship per simulation frame.
+static int Turret_targetable_parent_sig = -1;
+static int Turret_targetable_frame = -1;
+static ubyte Turret_targetable[MAX_OBJECTS];		// 0 = not checked yet, 1 = targetable, 2 = not targetable
+
+static int turret_object_is_targetable(object *objp, object *turret_parent_obj)
+{
+	int objnum = OBJ_INDEX(objp);
+
+	if ( (turret_parent_obj->signature != Turret_targetable_parent_sig) || (Simulation_framecount != Turret_targetable_frame) ) {
+		memset(Turret_targetable, 0, sizeof(Turret_targetable));
+		Turret_targetable_parent_sig = turret_parent_obj->signature;
+		Turret_targetable_frame = Simulation_framecount;
+	}
+
+	if (Turret_targetable[objnum] == 0) {
+		Turret_targetable[objnum] = object_is_targetable(objp, &Ships[turret_parent_obj->instance]) ? 1 : 2;
+	}
+
+	return (Turret_targetable[objnum] == 1);
+}
+
 void evaluate_obj_as_target(object *objp, eval_enemy_obj_struct *eeo)
 {
 	object	*turret_parent_obj = &Objects[eeo->turret_parent_objnum];
@@ -543,6 +566,15 @@ void evaluate_obj_as_target(object *objp, eval_enemy_obj_struct *eeo)
 	}
 #endif
 
+	// modify dist for BIG|HUGE, getting closest point on bbox, if not inside
+	vec3d vec_to_target;
+	vm_vec_sub(&vec_to_target, &objp->pos, eeo->tpos);
+	dist = vm_vec_mag_quick(&vec_to_target) - objp->radius;
+	
+	if (dist < 0.0f) {
+		dist = 0.0f;
+	}
+
 	if ( objp->type == OBJ_SHIP ) {
 		shipp = &Ships[objp->instance];
 
@@ -605,8 +637,14 @@ void evaluate_obj_as_target(object *objp, eval_enemy_obj_struct *eeo)
 			}
 		}
 
+		// ships out of weapon range are never picked below, so don't bother with the visibility check
+		// (except for stealth ships, where that check may roll the dice)
+		if ( (dist >= eeo->weapon_travel_dist) && !is_object_stealth_ship(objp) ) {
+			return;
+		}
+
 		// check if valid target in nebula
-		if ( !object_is_targetable(objp, &Ships[Objects[eeo->turret_parent_objnum].instance]) ) {
+		if ( !turret_object_is_targetable(objp, turret_parent_obj) ) {
 			// BYPASS ocassionally for stealth
 			int try_anyway = FALSE;
 			if ( is_object_stealth_ship(objp) ) {
@@ -626,15 +664,6 @@ void evaluate_obj_as_target(object *objp, eval_enemy_obj_struct *eeo)
 		shipp = NULL;
 	}
 
-	// modify dist for BIG|HUGE, getting closest point on bbox, if not inside
-	vec3d vec_to_target;
-	vm_vec_sub(&vec_to_target, &objp->pos, eeo->tpos);
-	dist = vm_vec_mag_quick(&vec_to_target) - objp->radius;
-	
-	if (dist < 0.0f) {
-		dist = 0.0f;
-	}
-	
 	dist_comp = dist;
 	// if weapon has optimum range set then use it
 	float optimum_range = ss->optimum_range;
@@ -1843,8 +1872,10 @@ bool turret_fire_weapon(int weapon_num, ship_subsys *turret, int parent_objnum,
 					// AL 1-6-97: Store pointer to turret subsystem
 					wp->turret_subsys = turret;	
 
-					Script_system.SetHookObjects(3, "Ship", &Objects[parent_objnum], "Weapon", objp, "Target", &Objects[turret->turret_enemy_objnum]);
-					Script_system.RunCondition(CHA_ONTURRETFIRED, 0, NULL, &Objects[parent_objnum]);
+					if (Script_system.IsActiveAction(CHA_ONTURRETFIRED)) {
+						Script_system.SetHookObjects(3, "Ship", &Objects[parent_objnum], "Weapon", objp, "Target", &Objects[turret->turret_enemy_objnum]);
+						Script_system.RunCondition(CHA_ONTURRETFIRED, 0, NULL, &Objects[parent_objnum]);
+					}
 
 					// if the gun is a flak gun
 					if(wip->wi_flags & WIF_FLAK){			
@@ -61,6 +61,9 @@ SCP_vector< asteroid_info > Asteroid_info;
 asteroid			Asteroids[MAX_ASTEROIDS];
 asteroid_field	Asteroid_field;
 
+// every slot in Asteroids[] below this is in use, so asteroid_create() starts looking here
+static int Asteroid_first_free = 0;
+
 
 static int		Asteroid_impact_explosion_ani;
 static float	Asteroid_impact_explosion_radius;
@@ -244,11 +247,12 @@ object *asteroid_create(asteroid_field *asfieldp, int asteroid_type, int asteroi
 		return NULL;
 	}
 
-	for (n=0; n<MAX_ASTEROIDS; n++) {
+	for (n=Asteroid_first_free; n<MAX_ASTEROIDS; n++) {
 		if (!(Asteroids[n].flags & AF_USED)) {
 			break;
 		}
 	}
+	Asteroid_first_free = n;
 
 	if (n >= MAX_ASTEROIDS) {
 		nprintf(("Warning","Could not create asteroid, no more slots left\n"));
@@ -280,6 +284,7 @@ object *asteroid_create(asteroid_field *asfieldp, int asteroid_type, int asteroi
 	asp->asteroid_subtype = asteroid_subtype;
 	asp->flags = 0;
 	asp->flags |= AF_USED;
+	Asteroid_first_free = n + 1;
 	asp->check_for_wrap = timestamp_rand(0, ASTEROID_CHECK_WRAP_TIMESTAMP);
 	asp->check_for_collide = timestamp_rand(0, ASTEROID_UPDATE_COLLIDE_TIMESTAMP);
 	asp->final_death_time = timestamp(-1);
@@ -622,6 +627,7 @@ void asteroid_level_init()
 {
 	Asteroid_field.num_initial_asteroids=0;
 	Num_asteroids = 0;
+	Asteroid_first_free = 0;
 	Next_asteroid_throw = timestamp(1);
 	asteroid_obj_list_init();
 	SCP_vector<asteroid_info>::iterator ast;
@@ -831,6 +837,10 @@ void asteroid_delete( object * obj )
 	asp->flags = 0;
 	Num_asteroids--;
 
+	if (num < Asteroid_first_free) {
+		Asteroid_first_free = num;
+	}
+
 	asteroid_obj_list_remove( obj );
 }
 
@@ -1399,6 +1409,7 @@ void asteroid_level_close()
 			Objects[Asteroids[i].objnum].flags |= OF_SHOULD_BE_DEAD;
 		}
 	}
+	Asteroid_first_free = 0;
 
 	Asteroid_field.num_initial_asteroids=0;
 }
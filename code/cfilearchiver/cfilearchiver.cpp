@@ -55,7 +55,6 @@ size_t fswrite_int(int *wint, FILE *stream)
 unsigned int Total_size=16; // Start with size of header
 unsigned int Num_files =0;
 FILE *fp_out = NULL;
-FILE *fp_out_hdr = NULL;
 
 typedef struct vp_header {
 	char id[4];
@@ -67,12 +66,20 @@ typedef struct vp_header {
 //vp_header Vp_header;
 
 char archive_dat[1024];
-char archive_hdr[1024];
 
-#define BLOCK_SIZE (1024*1024)
+#define BLOCK_SIZE (8*1024*1024)
+#define OUT_BUFFER_SIZE (8*1024*1024)
 #define VERSION_NUMBER 2;
 
-char tmp_data[BLOCK_SIZE];		// 1 MB
+#define INDEX_ENTRY_SIZE (4+4+32+4)
+
+char *tmp_data = NULL;		// BLOCK_SIZE, for copying file data
+char *out_buffer = NULL;	// OUT_BUFFER_SIZE, stdio buffer for the archive
+
+// the directory entries, kept in memory and appended to the archive once all the data is in
+char *index_data = NULL;
+size_t index_size = 0;
+size_t index_alloc = 0;
 
 void write_header()
 {
@@ -85,34 +92,45 @@ void write_header()
 	fswrite_int((int*)&Num_files, fp_out);
 }
 
-int write_index(char *hf, char *df)
+void index_write_int(char *dest, int val)
 {
-	FILE *h = NULL, *d = NULL;
-	unsigned int i;
-
-	h = fopen(hf, "rb");
-	d = fopen(df, "a+b");
-
-	if ( (h == NULL) || (d == NULL) )
-	{
-		if ( h )
-			fclose( h );
-		if ( d )
-			fclose( d );
-		return 0;
-	}
+	val = INT_SWAP(val);
+	memcpy(dest, &val, sizeof(int));
+}
+
+void add_index_entry(int offset, int size, char *name, int timestamp)
+{
+	char *entry;
+
+	if ( (index_size + INDEX_ENTRY_SIZE) > index_alloc ) {
+		size_t new_alloc = (index_alloc > 0) ? (index_alloc * 2) : (INDEX_ENTRY_SIZE * 1024);
+		char *new_data = (char *)realloc(index_data, new_alloc);
+
+		if ( new_data == NULL ) {
+			printf( "Out of memory building index!\n" );
+			exit(1);
+		}
 
-	for (i = 0; i < Num_files; i++) {
-		fread(tmp_data, 32+4+4+4, 1, h);
-		fwrite(tmp_data, 32+4+4+4, 1, d);
+		index_data = new_data;
+		index_alloc = new_alloc;
 	}
 
-	fclose(h);
-	fclose(d);
+	entry = index_data + index_size;
+	index_write_int(entry, offset);
+	index_write_int(entry+4, size);
+	memcpy(entry+8, name, 32);
+	index_write_int(entry+40, timestamp);
 
-	unlink(hf);
+	index_size += INDEX_ENTRY_SIZE;
+	Num_files++;
+}
+
+int write_index()
+{
+	if ( index_size == 0 )
+		return 1;
 
-	return 1;
+	return (fwrite(index_data, 1, index_size, fp_out) == index_size);
 }
 
 void pack_file( char *filespec, char *filename, int filesize, _fs_time_t time_write )
@@ -142,13 +160,9 @@ void pack_file( char *filespec, char *filename, int filesize, _fs_time_t time_wr
 	memset( path, 0, sizeof(path) );
 	strcpy_s( path, filename );
 
-	fswrite_int( (int*)&Total_size, fp_out_hdr );
-	fswrite_int( &filesize, fp_out_hdr );
-	fwrite( &path, 1, 32, fp_out_hdr );
-	fswrite_int( (int*)&time_write, fp_out_hdr );
+	add_index_entry( (int)Total_size, filesize, path, (int)time_write );
 
 	Total_size += filesize;
-	Num_files++;
 
 	printf( "Packing %s%s%s...", filespec, DIR_SEPARATOR_STR, filename );
 
@@ -184,22 +198,16 @@ void add_directory( char * dirname)
 	char path[256];
 	char *pathptr = path;
 	char *tmpptr;
-	int i = 0;
 
+	memset(path, 0, sizeof(path));
 	strcpy_s(path, dirname);
 
-	fswrite_int( (int*)&Total_size, fp_out_hdr);
-	fswrite_int( &i, fp_out_hdr);
-
 	// strip out any directories that this dir is a subdir of
 	while ( (tmpptr = strchr(pathptr, DIR_SEPARATOR_CHAR)) != NULL ) {
 		pathptr = tmpptr+1;
 	}
 
-	fwrite(pathptr, 1, 32, fp_out_hdr);
-	fswrite_int( &i, fp_out_hdr); // timestamp = 0
-
-	Num_files++;
+	add_index_entry( (int)Total_size, 0, pathptr, 0 ); // size = 0, timestamp = 0
 }
 
 void pack_directory( char * filespec)
@@ -371,8 +379,12 @@ int main(int argc, char *argv[] )
 	strcpy_s( archive_dat, archive );
 	strcat( archive_dat, ".vp" );
 
-	strcpy_s( archive_hdr, archive );
-	strcat( archive_hdr, ".hdr" );
+	tmp_data = (char *)malloc( BLOCK_SIZE );
+	out_buffer = (char *)malloc( OUT_BUFFER_SIZE );
+	if ( (tmp_data == NULL) || (out_buffer == NULL) ) {
+		printf( "Out of memory!\n" );
+		exit(1);
+	}
 
 	fp_out = fopen( archive_dat, "wb" );
 	if ( !fp_out )	{
@@ -386,17 +398,8 @@ int main(int argc, char *argv[] )
 #endif
 	}
 
-	fp_out_hdr = fopen( archive_hdr, "wb" );
-	if ( !fp_out_hdr )	{
-		printf( "Couldn't open '%s'!\n", archive_hdr );
-#ifdef _WIN32
-		printf( "Press any key to exit...\n" );
-		getch();
-		return 1;
-#else
-		exit(2);
-#endif
-	}
+	// write the archive in large chunks rather than stdio's default buffer size
+	setvbuf( fp_out, out_buffer, _IOFBF, OUT_BUFFER_SIZE );
 
 	if ( verify_directory( argv[2] ) != 0 ) {
 		printf("Warning! Last directory must be named \"data\" (not case sensitive)\n");
@@ -411,14 +414,9 @@ int main(int argc, char *argv[] )
 	if ( no_dir )
 		exit(4);
 
-	write_header();
-
-	fclose(fp_out);
-	fclose(fp_out_hdr);
-
 	printf( "Data files written, appending index...\n" );
 
-	if (!write_index(archive_hdr, archive_dat)) {
+	if (!write_index()) {
 		printf("Error appending index!\n");
 #ifdef _WIN32
 		printf("Press any key to exit...\n");
@@ -426,6 +424,14 @@ int main(int argc, char *argv[] )
 #endif
 		return 1;
 	}
+
+	write_header();
+
+	fclose(fp_out);
+
+	free(index_data);
+	free(out_buffer);
+	free(tmp_data);
 	
 	printf( "%d total KB.\n", Total_size/1024 );
 	return 0;
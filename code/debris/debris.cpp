@@ -43,6 +43,9 @@ debris Debris[MAX_DEBRIS_PIECES];
 int Num_debris_pieces = 0;
 int Debris_inited = 0;
 
+// every slot in Debris[] below this is in use, so debris_create() starts looking here
+static int Debris_first_free = 0;
+
 int Debris_model = -1;
 int Debris_vaporize_model = -1;
 int Debris_num_submodels = 0;
@@ -102,6 +105,7 @@ void debris_init()
 		Debris[i].flags = 0;
 		Debris[i].sound_delay = 0;
 	}
+	Debris_first_free = 0;
 		
 	Num_hull_pieces = 0;
 	list_init(&Hull_debris_list);
@@ -238,6 +242,10 @@ void debris_delete( object * obj )
 
 	db->flags = 0;
 	Num_debris_pieces--;
+
+	if (num < Debris_first_free) {
+		Debris_first_free = num;
+	}
 }
 
 /**
@@ -495,10 +503,11 @@ object *debris_create(object *source_obj, int model_num, int submodel_num, vec3d
 		}
 	}
 
-	for (n=0; n<MAX_DEBRIS_PIECES; n++ ) {
+	for (n=Debris_first_free; n<MAX_DEBRIS_PIECES; n++ ) {
 		if ( !(Debris[n].flags & DEBRIS_USED) )
 			break;
 	}
+	Debris_first_free = n;
 
 	if (n == MAX_DEBRIS_PIECES) {
 		n = debris_find_oldest();
@@ -558,6 +567,7 @@ object *debris_create(object *source_obj, int model_num, int submodel_num, vec3d
 		db->lifeleft *= 3.0f;
 	}
 	db->flags |= DEBRIS_USED;
+	Debris_first_free = n + 1;
 	db->is_hull = hull_flag;
 	db->source_objnum = parent_objnum;
 	db->source_sig = source_obj->signature;
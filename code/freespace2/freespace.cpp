@@ -968,6 +968,7 @@ void game_level_init(int seed)
 	}
 
 	Framecount = 0;
+	Simulation_framecount = 0;
 	game_reset_view_clip();
 	game_reset_shade_frame();
 
@@ -1416,8 +1417,12 @@ void game_post_level_init()
  */
 int game_start_mission()
 {
+	extern int Model_load_time;
+
 	mprintf(( "=================== STARTING LEVEL LOAD ==================\n" ));
 
+	Model_load_time = 0;
+
 	// clear post processing settings
 	gr_post_process_set_defaults();
 
@@ -1464,6 +1469,8 @@ int game_start_mission()
 	game_post_level_init();
 	load_post_level_init = (uint) (time(NULL) - load_post_level_init);
 
+	mprintf(( "Loading models for this level took %d ms\n", Model_load_time ));
+
 #ifndef NDEBUG
 	{
 		void Do_model_timings_test();
@@ -1735,6 +1742,7 @@ void game_init()
 	}
 
 	e1 = timer_get_milliseconds();
+	mprintf(("cfile_init() took %d\n", e1 - s1));
 
 	// initialize localization module. Make sure this is done AFTER initialzing OS.
 	lcl_init( detect_lang() );	
@@ -1955,8 +1963,11 @@ void game_init()
 	armor_init();
 	ai_init();
 	ai_profiles_init();		// Goober5000
+	s1 = timer_get_milliseconds();
 	weapon_init();	
 	ship_init();						// read in ships.tbl	
+	e1 = timer_get_milliseconds();
+	mprintf(("weapon_init() and ship_init() took %d\n", e1 - s1));
 
 	player_init();	
 	mission_campaign_init();		// load in the default campaign	
@@ -2012,7 +2023,7 @@ void game_init()
 	nprintf(("General", "Ships.tbl is : %s\n", Game_ships_tbl_valid ? "VALID" : "INVALID!!!!"));
 	nprintf(("General", "Weapons.tbl is : %s\n", Game_weapons_tbl_valid ? "VALID" : "INVALID!!!!"));
 
-	mprintf(("cfile_init() took %d\n", e1 - s1));	
+	mprintf(("Read and preprocessed %d KB of table text in %d ms\n", Parse_text_bytes / 1024, Parse_text_usecs / 1000));
 	Script_system.RunBytecode(Script_gameinithook);
 }
 
@@ -3872,6 +3883,8 @@ void game_flip_page_and_time_it()
 
 void game_simulation_frame()
 {
+	Simulation_framecount++;
+
 	//Do camera stuff
 	//This is for the warpout cam
 	if ( Player->control_mode != PCM_NORMAL )
@@ -11,6 +11,7 @@
 
 #include "freespace2/freespace.h"
 #include "freespace2/levelpaging.h"
+#include "io/timer.h"
 
 
 // All the page in functions
@@ -34,6 +35,10 @@ extern void mflash_page_in(bool);
 // loaded mission.  Call game_busy() occasionally...
 void level_page_in()
 {
+#ifndef NDEBUG
+	int start_time = timer_get_milliseconds();
+#endif
+
 	// Most important ones first
 	game_busy( NOX("*** paging in ships ***") );
 	ship_page_in();
@@ -62,6 +67,6 @@ void level_page_in()
 		bm_page_in_stop();
 	}
 
-	mprintf(( "Ending level bitmap paging...\n" ));
+	mprintf(( "Ending level bitmap paging... took %d ms\n", timer_get_milliseconds() - start_time ));
 
 }
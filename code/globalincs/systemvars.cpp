@@ -19,6 +19,7 @@
 fix Missiontime;
 fix Frametime;
 int	Framecount=0;
+int	Simulation_framecount=0;	// simulation frames this level; unlike Framecount, also counts frames that are not rendered
 
 int Game_mode;
 
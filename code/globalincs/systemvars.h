@@ -82,6 +82,7 @@ typedef struct vci {
 extern fix Missiontime;
 extern fix Frametime;
 extern int Framecount;
+extern int Simulation_framecount;
 
 extern int Game_mode;
 
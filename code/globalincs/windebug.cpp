@@ -1773,6 +1773,8 @@ void unregister_malloc(char *filename, int size, void *ptr)
 
 #endif
 
+MONITOR( NumMallocs )
+
 #ifndef NDEBUG
 void *_vm_malloc( int size, char *filename, int line, int quiet )
 #else
@@ -1781,6 +1783,8 @@ void *_vm_malloc( int size, int quiet )
 {
 	void *ptr = NULL;
 
+	MONITOR_INC( NumMallocs, 1 );
+
 	ptr = _malloc_dbg(size, _NORMAL_BLOCK, __FILE__, __LINE__ );
 
 	if (ptr == NULL)
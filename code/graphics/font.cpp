@@ -67,13 +67,57 @@ char *gr_force_fit_string(char *str, int max_str, int max_width)
 	return str;
 }
 
+/**
+ * Looks up the kerning offset between two letters (already offset into the font) by walking the
+ * font's kerning pair list.  Used to build font::kern_table, and to check it in debug builds.
+ */
+static int font_find_kerning(font *fnt, int letter, int letter2)
+{
+	int i = fnt->char_data[letter].kerning_entry;
+
+	if (i < 0)
+		return 0;
+
+	font_kernpair	*k = &fnt->kern_data[i];
+	while( (k->c1 == (char)letter) && (k->c2<(char)letter2) && (i<fnt->num_kern_pairs-1) )	{
+		i++;
+		k++;
+	}
+	if ( k->c2 == (char)letter2 )	{
+		return k->offset;
+	}
+
+	return 0;
+}
+
+/**
+ * Flattens the kerning pairs into a lookup table so get_char_width() doesn't have to search
+ * the pair list for every character drawn or measured
+ */
+static void font_build_kern_table(font *fnt)
+{
+	fnt->kern_table = NULL;
+
+	if ( (fnt->kern_data == NULL) || (fnt->num_kern_pairs <= 0) || (fnt->num_chars <= 0) )
+		return;
+
+	fnt->kern_table = (signed char *)vm_malloc( fnt->num_chars * fnt->num_chars );
+	Assert( fnt->kern_table != NULL );
+
+	for (int letter = 0; letter < fnt->num_chars; letter++) {
+		for (int letter2 = 0; letter2 < fnt->num_chars; letter2++) {
+			fnt->kern_table[letter * fnt->num_chars + letter2] = (signed char)font_find_kerning(fnt, letter, letter2);
+		}
+	}
+}
+
 /**
  * Takes the character BEFORE being offset into current font
  * @return the letter code
  */
 int get_char_width(ubyte c1,ubyte c2,int *width,int *spacing)
 {
-	int i, letter;
+	int letter;
 
 	Assert ( Current_font != NULL );
 	letter = c1-Current_font->first_ascii;
@@ -87,22 +131,19 @@ int get_char_width(ubyte c1,ubyte c2,int *width,int *spacing)
 	*width = Current_font->char_data[letter].byte_width;
 	*spacing = Current_font->char_data[letter].spacing;
 
-	i = Current_font->char_data[letter].kerning_entry;
-	if ( i > -1)  {
+	if ( Current_font->kern_table != NULL )  {
 		if (!(c2==0 || c2=='\n')) {
 			int letter2;
 
 			letter2 = c2-Current_font->first_ascii;
 
 			if ((letter2>=0) && (letter2<Current_font->num_chars) ) {				//not in font, draw as space
-				font_kernpair	*k = &Current_font->kern_data[i];
-				while( (k->c1 == (char)letter) && (k->c2<(char)letter2) && (i<Current_font->num_kern_pairs-1) )	{
-					i++;
-					k++;
-				}
-				if ( k->c2 == (char)letter2 )	{
-					*spacing += k->offset;
-				}
+				int offset = Current_font->kern_table[letter * Current_font->num_chars + letter2];
+
+				// debug builds check every lookup against the pair list the table was built from
+				Assert( offset == font_find_kerning(Current_font, letter, letter2) );
+
+				*spacing += offset;
 			}
 		}
 	}
@@ -327,6 +368,11 @@ void gr_font_close()
 			fnt->char_data = NULL;
 		}
 
+		if (fnt->kern_table) {
+			vm_free(fnt->kern_table);
+			fnt->kern_table = NULL;
+		}
+
 		if (fnt->pixel_data) {
 			vm_free(fnt->pixel_data);
 			fnt->pixel_data = NULL;
@@ -443,6 +489,8 @@ int gr_create_font(char * typeface)
 	}
 	cfclose(fp);
 
+	font_build_kern_table(fnt);
+
 	// Create a bitmap for hardware cards.
 	// JAS:  Try to squeeze this into the smallest square power of two texture.
 	// This should probably be done at font generation time, not here.
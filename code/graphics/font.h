@@ -48,6 +48,7 @@ typedef struct font {
 	font_kernpair	*kern_data;
 	font_char		*char_data;
 	ubyte				*pixel_data;
+	signed char		*kern_table;		// kerning offset for each (letter, next letter) pair, num_chars x num_chars
 
 	// Data for 3d cards
 	int				bitmap_id;			// A bitmap representing the font data
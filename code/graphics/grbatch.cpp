@@ -599,42 +599,37 @@ static SCP_vector<batch_item> distortion_map;
 effect_vertex *Batch_buffer = NULL;
 size_t Batch_buffer_size = 0;
 
-static size_t find_good_batch_item(int texture)
+// texture handle -> position in the matching map above; the maps keep first-use order, which is
+// the order things get drawn in, so these only speed up finding the right entry
+static SCP_hash_map<int, size_t> geometry_map_index;
+static SCP_hash_map<int, size_t> distortion_map_index;
+
+static size_t find_good_item(SCP_vector<batch_item> &map, SCP_hash_map<int, size_t> &map_index, int texture)
 {
-	size_t max_size = geometry_map.size();
+	SCP_hash_map<int, size_t>::iterator it = map_index.find(texture);
 
-	for (size_t i = 0; i < max_size; i++) {
-		if (geometry_map[i].texture == texture)
-			return i;
-	}
+	if (it != map_index.end())
+		return it->second;
 
 	// don't have an existing match so add a new entry
 	batch_item new_item;
 
 	new_item.texture = texture;
 
-	geometry_map.push_back(new_item);
+	map.push_back(new_item);
+	map_index[texture] = map.size() - 1;
 
-	return (geometry_map.size() - 1);
+	return (map.size() - 1);
 }
 
-static size_t find_good_distortion_item(int texture)
+static size_t find_good_batch_item(int texture)
 {
-	size_t max_size = distortion_map.size();
-
-	for (size_t i = 0; i < max_size; i++) {
-		if (distortion_map[i].texture == texture)
-			return i;
-	}
-
-	// don't have an existing match so add a new entry
-	batch_item new_item;
-
-	new_item.texture = texture;
-
-	distortion_map.push_back(new_item);
+	return find_good_item(geometry_map, geometry_map_index, texture);
+}
 
-	return (distortion_map.size() - 1);
+static size_t find_good_distortion_item(int texture)
+{
+	return find_good_item(distortion_map, distortion_map_index, texture);
 }
 
 float batch_add_laser(int texture, vec3d *p0, float width1, vec3d *p1, float width2, int r, int g, int b)
@@ -837,6 +832,8 @@ void batch_reset()
 {
 	geometry_map.clear();
 	distortion_map.clear();
+	geometry_map_index.clear();
+	distortion_map_index.clear();
 }
 
 void batch_render_close()
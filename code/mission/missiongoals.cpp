@@ -184,6 +184,17 @@ static goal_text Goal_text;
 static int Mission_directive_sound_timestamp;	// timestamp to control when directive succcess sound gets played
 static int Mission_directive_special_timestamp;	// used to specially mark a directive as true even though it's not
 
+// Events that can still be evaluated, in event order.  An event never comes back once its formula
+// goes to -1, so finished events are dropped from here as the evaluation loops come across them.
+// Num_active_events is -1 until the list is built on the first evaluation of a mission.
+static int Active_events[MAX_MISSION_EVENTS];
+static int Num_active_events = -1;
+
+// earliest timestamp of any repeating event, so the repeat pass can be skipped until one is due
+static int Next_repeat_timestamp = 0;
+
+MONITOR(NumEventsProcessed)
+
 char *Goal_type_text(int n)
 {
 	switch (n) {
@@ -371,6 +382,8 @@ void mission_init_goals()
 	}
 
 	Num_mission_events = 0;
+	Num_active_events = -1;
+	Next_repeat_timestamp = 0;
 	for (i=0; i<MAX_MISSION_EVENTS; i++) {
 		Mission_events[i].result = 0;
 		Mission_events[i].flags = 0;
@@ -1022,20 +1035,67 @@ void mission_maybe_play_directive_success_sound()
 	}
 }
 
+// removes finished events from Active_events, keeping the rest in order
+static void mission_prune_active_events()
+{
+	int i, num = 0;
+
+	for (i = 0; i < Num_active_events; i++) {
+		if (Mission_events[Active_events[i]].formula != -1) {
+			Active_events[num++] = Active_events[i];
+		}
+	}
+
+	Num_active_events = num;
+}
+
+// keeps Next_repeat_timestamp at or before the timestamp of the given event if it is a repeating one
+static void mission_note_repeat_timestamp(int event)
+{
+	int stamp = Mission_events[event].timestamp;
+
+	if ( (Mission_events[event].formula == -1) || !timestamp_valid(stamp) ) {
+		return;
+	}
+
+	if ( !timestamp_valid(Next_repeat_timestamp) || (stamp < Next_repeat_timestamp) ) {
+		Next_repeat_timestamp = stamp;
+	}
+}
+
 void mission_eval_goals()
 {
-	int i, result;
+	int i, n, result;
+
+	if (Num_active_events < 0) {
+		Num_active_events = 0;
+		for (i=0; i<Num_mission_events; i++) {
+			if (Mission_events[i].formula != -1) {
+				Active_events[Num_active_events++] = i;
+				mission_note_repeat_timestamp(i);
+			}
+		}
+	}
 
 	// before checking whether or not we should evaluate goals, we should run through the events and
 	// process any whose timestamp is valid and has expired.  This would catch repeating events only
-	for (i=0; i<Num_mission_events; i++) {
-		if (Mission_events[i].formula != -1) {
-			if ( !timestamp_valid(Mission_events[i].timestamp) || !timestamp_elapsed(Mission_events[i].timestamp) ){
-				continue;
-			}
+	if ( timestamp_elapsed(Next_repeat_timestamp) ) {
+		Next_repeat_timestamp = 0;
+
+		for (n=0; n<Num_active_events; n++) {
+			i = Active_events[n];
 
-			// if we get here, then the timestamp on the event has popped -- we should reevaluate
-			mission_process_event(i);
+			if (Mission_events[i].formula != -1) {
+				if ( !timestamp_valid(Mission_events[i].timestamp) || !timestamp_elapsed(Mission_events[i].timestamp) ){
+					mission_note_repeat_timestamp(i);
+					continue;
+				}
+
+				// if we get here, then the timestamp on the event has popped -- we should reevaluate
+				mission_process_event(i);
+				MONITOR_INC(NumEventsProcessed, 1);
+				mission_note_repeat_timestamp(i);
+			}
 		}
 	}
 	
@@ -1063,17 +1123,25 @@ void mission_eval_goals()
 	} // end for
 
 	// now evaluate any mission events
-	for (i=0; i<Num_mission_events; i++) {
+	for (n=0; n<Num_active_events; n++) {
+		i = Active_events[n];
+
 		if ( Mission_events[i].formula != -1 ) {
 			// only evaluate this event if the timestamp is not valid.  We do this since
 			// we will evaluate repeatable events at the top of the file so we can get
 			// the exact interval that the designer asked for.
 			if ( !timestamp_valid( Mission_events[i].timestamp) ){
 				mission_process_event( i );
+				MONITOR_INC(NumEventsProcessed, 1);
+
+				// a true event picks up its repeat interval here
+				mission_note_repeat_timestamp(i);
 			}
 		}
 	}
 
+	mission_prune_active_events();
+
 	// send and remaining sexp data to the clients
 	if (MULTIPLAYER_MASTER) {
 		multi_sexp_flush_packet();
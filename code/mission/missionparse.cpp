@@ -123,6 +123,13 @@ p_object Ship_arrival_list;	// for linked list of ships to arrive later
 // all the ships that we parse
 SCP_vector<p_object> Parse_objects;
 
+// Name and net signature indexes into Parse_objects, each holding the first parse object with a given key.
+// Names are keyed by hash_string_nocase().  Wing ships are renamed and re-signed with every wave, so anything
+// that changes Parse_objects or one of those fields marks the indexes dirty and the next lookup rebuilds them.
+static SCP_hash_map<uint, int> Parse_object_name_index;
+static SCP_hash_map<ushort, int> Parse_object_signature_index;
+static bool Parse_object_index_dirty = true;
+
 
 // list for arriving support ship
 p_object	Support_ship_pobj;
@@ -3633,6 +3640,7 @@ void parse_objects(mission *pm, int flag)
 
 	// parse in objects
 	Parse_objects.clear();
+	Parse_object_index_dirty = true;
 	while (required_string_either("#Wings", "$Name:"))
 	{
 		p_object pobj;
@@ -3646,6 +3654,7 @@ void parse_objects(mission *pm, int flag)
 
 		// add it
 		Parse_objects.push_back(pobj);
+		Parse_object_index_dirty = true;
 
 		// send out a ping if we are multi so that psnet2 doesn't kill us off for a long load
 		// NOTE that we can't use the timestamp*() functions here since they won't increment
@@ -3758,31 +3767,107 @@ void swap_parse_object(p_object *p_obj, int new_ship_class)
 	}
 }
 
-p_object *mission_parse_get_parse_object(ushort net_signature)
+static void mission_parse_index_parse_objects()
 {
 	int i;
 
-	// look for original ships
+	Parse_object_name_index.clear();
+	Parse_object_signature_index.clear();
+
+	// keep the first object for each key, which is the one a linear search would find
 	for (i = 0; i < (int)Parse_objects.size(); i++)
-		if(Parse_objects[i].net_signature == net_signature)
-			return &Parse_objects[i];
+	{
+		uint hash = hash_string_nocase(Parse_objects[i].name);
 
-	// boo
-	return NULL;
+		if (Parse_object_name_index.find(hash) == Parse_object_name_index.end())
+			Parse_object_name_index[hash] = i;
+
+		if (Parse_object_signature_index.find(Parse_objects[i].net_signature) == Parse_object_signature_index.end())
+			Parse_object_signature_index[Parse_objects[i].net_signature] = i;
+	}
+
+	Parse_object_index_dirty = false;
+}
+
+p_object *mission_parse_get_parse_object(ushort net_signature)
+{
+	p_object *p_objp = NULL;
+
+	if (Parse_object_index_dirty)
+		mission_parse_index_parse_objects();
+
+	// look for original ships
+	SCP_hash_map<ushort, int>::iterator it = Parse_object_signature_index.find(net_signature);
+	if (it != Parse_object_signature_index.end())
+		p_objp = &Parse_objects[it->second];
+
+#ifndef NDEBUG
+	// the index has to give the same answer as a plain linear search
+	{
+		p_object *linear = NULL;
+
+		for (int i = 0; i < (int)Parse_objects.size(); i++) {
+			if (Parse_objects[i].net_signature == net_signature) {
+				linear = &Parse_objects[i];
+				break;
+			}
+		}
+
+		Assertion(p_objp == linear, "Parse object signature index disagrees with a linear search for signature %d", (int)net_signature);
+	}
+#endif
+
+	return p_objp;
 }
 
 // Goober5000 - also get it by name
 p_object *mission_parse_get_parse_object(char *name)
 {
 	int i;
+	p_object *p_objp = NULL;
+
+	if (Parse_object_index_dirty)
+		mission_parse_index_parse_objects();
 
 	// look for original ships
-	for (i = 0; i < (int)Parse_objects.size(); i++)
-		if(!stricmp(Parse_objects[i].name, name))
-			return &Parse_objects[i];
+	SCP_hash_map<uint, int>::iterator it = Parse_object_name_index.find(hash_string_nocase(name));
+	if (it != Parse_object_name_index.end())
+	{
+		if (!stricmp(Parse_objects[it->second].name, name))
+		{
+			p_objp = &Parse_objects[it->second];
+		}
+		else
+		{
+			// two names share a hash, so do it the slow way
+			for (i = 0; i < (int)Parse_objects.size(); i++)
+			{
+				if (!stricmp(Parse_objects[i].name, name))
+				{
+					p_objp = &Parse_objects[i];
+					break;
+				}
+			}
+		}
+	}
 
-	// boo
-	return NULL;
+#ifndef NDEBUG
+	// the index has to give the same answer as a plain linear search
+	{
+		p_object *linear = NULL;
+
+		for (i = 0; i < (int)Parse_objects.size(); i++) {
+			if (!stricmp(Parse_objects[i].name, name)) {
+				linear = &Parse_objects[i];
+				break;
+			}
+		}
+
+		Assertion(p_objp == linear, "Parse object name index disagrees with a linear search for '%s'", name);
+	}
+#endif
+
+	return p_objp;
 }
 
 int find_wing_name(char *name)
@@ -3990,6 +4075,7 @@ int parse_wing_create_ships( wing *wingp, int num_to_create, int force, int spec
 		{
 			sprintf(p_objp->name, NOX("%s %d"), wingp->name, wingp->total_arrived_count);
 		}
+		Parse_object_index_dirty = true;
 
 
 		objnum = parse_create_object(p_objp);
@@ -573,29 +573,41 @@ void model_interp_defpoints(ubyte * p, polymodel *pm, bsp_info *sm)
 			}
 			dest++;
 		} 
-	} else {
-		vec3d point;
+	} else if ( Cmdline_nohtl || (GEOMETRY_NOISE == 0.0f) ) {
+		// nothing to do to the points themselves, so just collect them
+		// and rotate the whole list in one go
+		for (n=0; n<nverts; n++ )	{
+			Interp_verts[n] = src;
 
-		for (n=0; n<nverts; n++ )	{	
+			src++;		// move to normal
 
-			if(!Cmdline_nohtl) {
-				if(GEOMETRY_NOISE!=0.0f){
-					GEOMETRY_NOISE = model_radius / 50;
-
-					Interp_verts[n] = src;	
-					point.xyz.x = src->xyz.x + frand_range(GEOMETRY_NOISE,-GEOMETRY_NOISE);
-					point.xyz.y = src->xyz.y + frand_range(GEOMETRY_NOISE,-GEOMETRY_NOISE);
-					point.xyz.z = src->xyz.z + frand_range(GEOMETRY_NOISE,-GEOMETRY_NOISE);
-							
-					g3_rotate_vertex(dest, &point);
-				}else{
-					Interp_verts[n] = src;	
-					g3_rotate_vertex(dest, src);
-				}
+			for (i=0; i<normcount[n]; i++ )	{
+				Interp_light_applied[next_norm] = 0;
+				Interp_norms[next_norm] = src;
+
+				next_norm++;
+				src++;
 			}
-			else {
-				Interp_verts[n] = src; 	 	 
+		}
+
+		g3_rotate_vertices(dest, Interp_verts, nverts);
+	} else {
+		vec3d point;
 
+		for (n=0; n<nverts; n++ )	{	
+			// the noise can drop to zero partway through (model_radius of 0),
+			// after which points are rotated as they are
+			if(GEOMETRY_NOISE!=0.0f){
+				GEOMETRY_NOISE = model_radius / 50;
+
+				Interp_verts[n] = src;	
+				point.xyz.x = src->xyz.x + frand_range(GEOMETRY_NOISE,-GEOMETRY_NOISE);
+				point.xyz.y = src->xyz.y + frand_range(GEOMETRY_NOISE,-GEOMETRY_NOISE);
+				point.xyz.z = src->xyz.z + frand_range(GEOMETRY_NOISE,-GEOMETRY_NOISE);
+						
+				g3_rotate_vertex(dest, &point);
+			}else{
+				Interp_verts[n] = src;	
 				g3_rotate_vertex(dest, src);
 			}
 
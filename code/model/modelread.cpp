@@ -71,6 +71,8 @@ char	Global_filename[256];
 int Model_ram = 0;			// How much RAM the models use total
 #endif
 
+int Model_load_time = 0;	// How long model_load() has spent reading and setting up models, in ms
+
 static uint Global_checksum = 0;
 
 // Anything less than this is considered incompatible.
@@ -760,11 +762,14 @@ void create_vertex_buffer(polymodel *pm)
 		if (ibuffer_info.read != NULL) {
 			bool ibx_valid = false;
 
+#ifndef NDEBUG
 			// grab a checksum of the IBX, for debugging purposes
+			// (this reads the whole file, so don't bother in release builds where it's never printed)
 			uint ibx_checksum = 0;
 			cfseek(ibuffer_info.read, 0, SEEK_SET);
 			cf_chksum_long(ibuffer_info.read, &ibx_checksum);
 			cfseek(ibuffer_info.read, 0, SEEK_SET);
+#endif
 
 			// get the file size that we use to safety check with.
 			// be sure to subtract from this when we read something out
@@ -2480,6 +2485,8 @@ int model_load(char *filename, int n_subsystems, model_subsystem *subsystems, in
 
 	mprintf(( "Loading model '%s'\n", filename ));
 
+	int load_start = timer_get_milliseconds();
+
 	pm = (polymodel *)vm_malloc( sizeof(polymodel) );
 	Assert( pm != NULL );
 	
@@ -2722,6 +2729,10 @@ int model_load(char *filename, int n_subsystems, model_subsystem *subsystems, in
 	model_set_subsys_path_nums(pm, n_subsystems, subsystems);
 	model_set_bay_path_nums(pm);
 
+	int load_time = timer_get_milliseconds() - load_start;
+	Model_load_time += load_time;
+	mprintf(( "Model '%s' took %d ms to load\n", filename, load_time ));
+
 	return pm->id;
 }
 
@@ -214,6 +214,11 @@ void multi_set_network_signature( ushort signature, int what_kind )
 		Int3();			// get Allender
 }
 
+// the object last found for each network signature.  Entries are only hints: they are checked
+// against the object before being trusted, so nothing has to keep them in sync when objects
+// are created, deleted or have their net_signature changed.
+static short Net_signature_objnum[65536];		// one per possible ushort signature
+
 // multi_get_network_object() takes a net_signature and tries to locate the object in the object list
 // with that network signature.  Returns NULL if the object cannot be found
 object *multi_get_network_object( ushort net_signature )
@@ -226,6 +231,11 @@ object *multi_get_network_object( ushort net_signature )
 	if(GET_FIRST(&obj_used_list) == NULL)
 		return NULL;
 
+	// free objects are always OBJ_NONE, so a match here is on either the used or the create list
+	objp = &Objects[Net_signature_objnum[net_signature]];
+	if ( (objp->type != OBJ_NONE) && (objp->net_signature == net_signature) )
+		return objp;
+
 	for ( objp = GET_FIRST(&obj_used_list); objp != END_OF_LIST(&obj_used_list); objp = GET_NEXT(objp) )
 		if ( objp->net_signature == net_signature )
 			break;
@@ -240,6 +250,9 @@ object *multi_get_network_object( ushort net_signature )
 			objp = NULL;
 	}
 
+	if ( objp != NULL )
+		Net_signature_objnum[net_signature] = (short)OBJ_INDEX(objp);
+
 	return objp;
 }
 
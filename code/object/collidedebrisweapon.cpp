@@ -54,11 +54,16 @@ int collide_debris_weapon( obj_pair * pair )
 		if ( !hit )
 			return 0;
 
-		Script_system.SetHookObjects(4, "Weapon", weapon, "Debris", pdebris, "Self",weapon, "Object", pdebris);
-		bool weapon_override = Script_system.IsConditionOverride(CHA_COLLIDEDEBRIS, weapon);
+		bool scripted = (Script_system.IsActiveAction(CHA_COLLIDEDEBRIS) || Script_system.IsActiveAction(CHA_COLLIDEWEAPON));
+		bool weapon_override = false, debris_override = false;
 
-		Script_system.SetHookObjects(2, "Self",pdebris, "Object", weapon);
-		bool debris_override = Script_system.IsConditionOverride(CHA_COLLIDEWEAPON, pdebris);
+		if (scripted) {
+			Script_system.SetHookObjects(4, "Weapon", weapon, "Debris", pdebris, "Self",weapon, "Object", pdebris);
+			weapon_override = Script_system.IsConditionOverride(CHA_COLLIDEDEBRIS, weapon);
+
+			Script_system.SetHookObjects(2, "Self",pdebris, "Object", weapon);
+			debris_override = Script_system.IsConditionOverride(CHA_COLLIDEWEAPON, pdebris);
+		}
 
 		if(!weapon_override && !debris_override)
 		{
@@ -66,15 +71,17 @@ int collide_debris_weapon( obj_pair * pair )
 			debris_hit( pdebris, weapon, &hitpos, Weapon_info[Weapons[weapon->instance].weapon_info_index].damage );
 		}
 
-		Script_system.SetHookObjects(2, "Self",weapon, "Object", pdebris);
-		if(!(debris_override && !weapon_override))
-			Script_system.RunCondition(CHA_COLLIDEDEBRIS, '\0', NULL, weapon);
+		if (scripted) {
+			Script_system.SetHookObjects(2, "Self",weapon, "Object", pdebris);
+			if(!(debris_override && !weapon_override))
+				Script_system.RunCondition(CHA_COLLIDEDEBRIS, '\0', NULL, weapon);
 
-		Script_system.SetHookObjects(2, "Self",pdebris, "Object", weapon);
-		if((debris_override && !weapon_override) || (!debris_override && !weapon_override))
-			Script_system.RunCondition(CHA_COLLIDEWEAPON, '\0', NULL, pdebris);
+			Script_system.SetHookObjects(2, "Self",pdebris, "Object", weapon);
+			if((debris_override && !weapon_override) || (!debris_override && !weapon_override))
+				Script_system.RunCondition(CHA_COLLIDEWEAPON, '\0', NULL, pdebris);
 
-		Script_system.RemHookVars(4, "Weapon", "Debris", "Self","ObjectB");
+			Script_system.RemHookVars(4, "Weapon", "Debris", "Self","ObjectB");
+		}
 		return 0;
 
 	} else {
@@ -109,11 +116,16 @@ int collide_asteroid_weapon( obj_pair * pair )
 		if ( !hit )
 			return 0;
 
-		Script_system.SetHookObjects(4, "Weapon", weapon, "Asteroid", pasteroid, "Self",weapon, "Object", pasteroid);
+		bool scripted = (Script_system.IsActiveAction(CHA_COLLIDEASTEROID) || Script_system.IsActiveAction(CHA_COLLIDEWEAPON));
+		bool weapon_override = false, asteroid_override = false;
 
-		bool weapon_override = Script_system.IsConditionOverride(CHA_COLLIDEASTEROID, weapon);
-		Script_system.SetHookObjects(2, "Self",pasteroid, "Object", weapon);
-		bool asteroid_override = Script_system.IsConditionOverride(CHA_COLLIDEWEAPON, pasteroid);
+		if (scripted) {
+			Script_system.SetHookObjects(4, "Weapon", weapon, "Asteroid", pasteroid, "Self",weapon, "Object", pasteroid);
+
+			weapon_override = Script_system.IsConditionOverride(CHA_COLLIDEASTEROID, weapon);
+			Script_system.SetHookObjects(2, "Self",pasteroid, "Object", weapon);
+			asteroid_override = Script_system.IsConditionOverride(CHA_COLLIDEWEAPON, pasteroid);
+		}
 
 		if(!weapon_override && !asteroid_override)
 		{
@@ -121,15 +133,17 @@ int collide_asteroid_weapon( obj_pair * pair )
 			asteroid_hit( pasteroid, weapon, &hitpos, Weapon_info[Weapons[weapon->instance].weapon_info_index].damage );
 		}
 
-		Script_system.SetHookObjects(2, "Self",weapon, "Object", pasteroid);
-		if(!(asteroid_override && !weapon_override))
-			Script_system.RunCondition(CHA_COLLIDEASTEROID, '\0', NULL, weapon);
+		if (scripted) {
+			Script_system.SetHookObjects(2, "Self",weapon, "Object", pasteroid);
+			if(!(asteroid_override && !weapon_override))
+				Script_system.RunCondition(CHA_COLLIDEASTEROID, '\0', NULL, weapon);
 
-		Script_system.SetHookObjects(2, "Self",pasteroid, "Object", weapon);
-		if((asteroid_override && !weapon_override) || (!asteroid_override && !weapon_override))
-			Script_system.RunCondition(CHA_COLLIDEWEAPON, '\0', NULL, pasteroid);
+			Script_system.SetHookObjects(2, "Self",pasteroid, "Object", weapon);
+			if((asteroid_override && !weapon_override) || (!asteroid_override && !weapon_override))
+				Script_system.RunCondition(CHA_COLLIDEWEAPON, '\0', NULL, pasteroid);
 
-		Script_system.RemHookVars(4, "Weapon", "Asteroid", "Self","ObjectB");
+			Script_system.RemHookVars(4, "Weapon", "Asteroid", "Self","ObjectB");
+		}
 		return 0;
 
 	} else {
@@ -282,25 +282,33 @@ int ship_weapon_check_collision(object *ship_objp, object *weapon_objp, float ti
 		wp->collisionOccured = true;
 		wp->collisionInfo = mc_info(mc);
 
-		Script_system.SetHookObjects(4, "Ship", ship_objp, "Weapon", weapon_objp, "Self",ship_objp, "Object", weapon_objp);
-		bool ship_override = Script_system.IsConditionOverride(CHA_COLLIDEWEAPON, ship_objp);
+		// skip the hook variables entirely if no script cares about this collision
+		bool scripted = (Script_system.IsActiveAction(CHA_COLLIDEWEAPON) || Script_system.IsActiveAction(CHA_COLLIDESHIP));
+		bool ship_override = false, weapon_override = false;
 
-		Script_system.SetHookObjects(2, "Self",weapon_objp, "Object", ship_objp);
-		bool weapon_override = Script_system.IsConditionOverride(CHA_COLLIDESHIP, weapon_objp);
+		if (scripted) {
+			Script_system.SetHookObjects(4, "Ship", ship_objp, "Weapon", weapon_objp, "Self",ship_objp, "Object", weapon_objp);
+			ship_override = Script_system.IsConditionOverride(CHA_COLLIDEWEAPON, ship_objp);
+
+			Script_system.SetHookObjects(2, "Self",weapon_objp, "Object", ship_objp);
+			weapon_override = Script_system.IsConditionOverride(CHA_COLLIDESHIP, weapon_objp);
+		}
 
 		if(!ship_override && !weapon_override) {
 			ship_weapon_do_hit_stuff(ship_objp, weapon_objp, &mc.hit_point_world, &mc.hit_point, quadrant_num, mc.hit_submodel, mc.hit_normal);
 		}
 
-		Script_system.SetHookObjects(2, "Self",ship_objp, "Object", weapon_objp);
-		if(!(weapon_override && !ship_override))
-			Script_system.RunCondition(CHA_COLLIDEWEAPON, '\0', NULL, ship_objp);
+		if (scripted) {
+			Script_system.SetHookObjects(2, "Self",ship_objp, "Object", weapon_objp);
+			if(!(weapon_override && !ship_override))
+				Script_system.RunCondition(CHA_COLLIDEWEAPON, '\0', NULL, ship_objp);
 
-		Script_system.SetHookObjects(2, "Self",weapon_objp, "Object", ship_objp);
-		if((weapon_override && !ship_override) || (!weapon_override && !ship_override))
-			Script_system.RunCondition(CHA_COLLIDESHIP, '\0', NULL, weapon_objp);
+			Script_system.SetHookObjects(2, "Self",weapon_objp, "Object", ship_objp);
+			if((weapon_override && !ship_override) || (!weapon_override && !ship_override))
+				Script_system.RunCondition(CHA_COLLIDESHIP, '\0', NULL, weapon_objp);
 
-		Script_system.RemHookVars(4, "Ship", "Weapon", "Self","Object");
+			Script_system.RemHookVars(4, "Ship", "Weapon", "Self","Object");
+		}
 	}
 	else if ((Missiontime - wp->creation_time > F1_0/2) && (wip->wi_flags & WIF_HOMING) && (wp->homing_object == ship_objp)) {
 		if (dist < wip->shockwave.inner_rad) {
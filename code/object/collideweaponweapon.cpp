@@ -83,12 +83,17 @@ int collide_weapon_weapon( obj_pair * pair )
 	//	Rats, do collision detection.
 	if (collide_subdivide(&A->last_pos, &A->pos, A_radius, &B->last_pos, &B->pos, B_radius))
 	{
-		Script_system.SetHookObjects(4, "Weapon", A, "WeaponB", B, "Self",A, "Object", B);
-		bool a_override = Script_system.IsConditionOverride(CHA_COLLIDEWEAPON, A);
+		bool scripted = Script_system.IsActiveAction(CHA_COLLIDEWEAPON);
+		bool a_override = false, b_override = false;
+
+		if (scripted) {
+			Script_system.SetHookObjects(4, "Weapon", A, "WeaponB", B, "Self",A, "Object", B);
+			a_override = Script_system.IsConditionOverride(CHA_COLLIDEWEAPON, A);
 		
-		//Should be reversed
-		Script_system.SetHookObjects(4, "Weapon", B, "WeaponB", A, "Self",B, "Object", A);
-		bool b_override = Script_system.IsConditionOverride(CHA_COLLIDEWEAPON, B);
+			//Should be reversed
+			Script_system.SetHookObjects(4, "Weapon", B, "WeaponB", A, "Self",B, "Object", A);
+			b_override = Script_system.IsConditionOverride(CHA_COLLIDEWEAPON, B);
+		}
 
 		if(!a_override && !b_override)
 		{
@@ -176,19 +181,21 @@ int collide_weapon_weapon( obj_pair * pair )
 	#endif
 		}
 
-		if(!(b_override && !a_override))
-		{
-			Script_system.SetHookObjects(4, "Weapon", A, "WeaponB", B, "Self",A, "Object", B);
-			Script_system.RunCondition(CHA_COLLIDEWEAPON, '\0', NULL, A);
-		}
-		if((b_override && !a_override) || (!b_override && !a_override))
-		{
-			//Should be reversed
-			Script_system.SetHookObjects(4, "Weapon", B, "WeaponB", A, "Self",B, "Object", A);
-			Script_system.RunCondition(CHA_COLLIDEWEAPON, '\0', NULL, B);
-		}
+		if (scripted) {
+			if(!(b_override && !a_override))
+			{
+				Script_system.SetHookObjects(4, "Weapon", A, "WeaponB", B, "Self",A, "Object", B);
+				Script_system.RunCondition(CHA_COLLIDEWEAPON, '\0', NULL, A);
+			}
+			if((b_override && !a_override) || (!b_override && !a_override))
+			{
+				//Should be reversed
+				Script_system.SetHookObjects(4, "Weapon", B, "WeaponB", A, "Self",B, "Object", A);
+				Script_system.RunCondition(CHA_COLLIDEWEAPON, '\0', NULL, B);
+			}
 
-		Script_system.RemHookVars(4, "Weapon", "WeaponB", "Self","ObjectB");
+			Script_system.RemHookVars(4, "Weapon", "WeaponB", "Self","ObjectB");
+		}
 		return 1;
 	}
 
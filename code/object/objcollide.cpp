@@ -1195,8 +1195,9 @@ void obj_sort_and_collide()
 	if ( !(Game_detail_flags & DETAIL_FLAG_COLLISION) )
 		return;
 
-	SCP_vector<int> sort_list_y;
-	SCP_vector<int> sort_list_z;
+	// kept between frames so their storage gets reused
+	static SCP_vector<int> sort_list_y;
+	static SCP_vector<int> sort_list_z;
 
 	sort_list_y.clear();
 	obj_quicksort_colliders(&Collision_sort_list, 0, Collision_sort_list.size() - 1, 0);
@@ -1211,12 +1212,32 @@ void obj_sort_and_collide()
 	obj_find_overlap_colliders(&sort_list_y, &sort_list_z, 2, true);
 }
 
+MONITOR(NumSweepPairs)
+MONITOR(NumSweepPairsSkipped)
+
+// Weapons that can't be shot down never collide with each other (see the OBJ_WEAPON:OBJ_WEAPON case
+// in obj_collide_pair()), so the sweep doesn't count them as overlapping.  Laser and flak storms
+// would otherwise fill the later passes with pairs that can only be thrown away.
+static int obj_collider_is_plain_weapon(int obj_num)
+{
+	object *objp = &Objects[obj_num];
+
+	if (objp->type != OBJ_WEAPON)
+		return 0;
+
+	return !(Weapon_info[Weapons[objp->instance].weapon_info_index].weapon_hitpoints > 0);
+}
+
+// which sweep last put each object on its output list
+static int Overlap_pass = 0;
+static int Overlap_added_pass[MAX_OBJECTS];
+
 void obj_find_overlap_colliders(SCP_vector<int> *overlap_list_out, SCP_vector<int> *list, int axis, bool collide)
 {
 	size_t i, j;
 	bool overlapped;
-	bool first_not_added = true;
-	SCP_vector<int> overlappers;
+	bool plain_weapon;
+	static SCP_vector<int> overlappers;
 
 	float min;
 	float max;
@@ -1225,8 +1246,11 @@ void obj_find_overlap_colliders(SCP_vector<int> *overlap_list_out, SCP_vector<in
 	
 	overlappers.clear();
 
+	Overlap_pass++;
+
 	for ( i = 0; i < (*list).size(); ++i ) {
 		overlapped = false;
+		plain_weapon = (obj_collider_is_plain_weapon((*list)[i]) != 0);
 
 		min = obj_get_collider_endpoint((*list)[i], axis, true);
 		max = obj_get_collider_endpoint((*list)[i], axis, false);
@@ -1235,14 +1259,21 @@ void obj_find_overlap_colliders(SCP_vector<int> *overlap_list_out, SCP_vector<in
 			overlap_min = obj_get_collider_endpoint(overlappers[j], axis, true);
 			overlap_max = obj_get_collider_endpoint(overlappers[j], axis, false);
 			if ( min <= overlap_max ) {
+				if ( plain_weapon && obj_collider_is_plain_weapon(overlappers[j]) ) {
+					MONITOR_INC(NumSweepPairsSkipped, 1);
+					++j;
+					continue;
+				}
+
 				overlapped = true;
 
-				if ( overlappers.size() == 1 && first_not_added ) {
-					first_not_added = false;
+				if ( Overlap_added_pass[overlappers[j]] != Overlap_pass ) {
+					Overlap_added_pass[overlappers[j]] = Overlap_pass;
 					overlap_list_out->push_back(overlappers[j]);
 				}
 				
 				if ( collide ) {
+					MONITOR_INC(NumSweepPairs, 1);
 					obj_collide_pair(&Objects[(*list)[i]], &Objects[overlappers[j]]);
 				}
 			} else {
@@ -1254,18 +1285,13 @@ void obj_find_overlap_colliders(SCP_vector<int> *overlap_list_out, SCP_vector<in
 			++j;
 		}
 
-		if ( overlappers.size() == 0 ) {
-			first_not_added = true;
-		}
-
 		if ( overlapped ) {
+			Overlap_added_pass[(*list)[i]] = Overlap_pass;
 			overlap_list_out->push_back((*list)[i]);
 		}
 
 		overlappers.push_back((*list)[i]);
 	}
-
-	overlapped = true;
 }
 
 float obj_get_collider_endpoint(int obj_num, int axis, bool min)
@@ -1328,6 +1328,46 @@ int Collisions_enabled = 1;
 
 DCF_BOOL( collisions, Collisions_enabled )
 
+// When set, the frametime and obj_state_hash() are logged after every simulation step.  Two runs
+// of the same mission can then be compared line by line to find the frame where they diverge.
+int Log_state_hash = 0;
+DCF_BOOL( state_hash, Log_state_hash )
+
+// folds len bytes into an FNV-1a hash
+static uint obj_hash_bytes(uint hash, const void *data, size_t len)
+{
+	const ubyte *p = (const ubyte *)data;
+
+	while (len--) {
+		hash ^= *p++;
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+/**
+ * Hash of the simulation state of every object in use: type, signature, position, orientation,
+ * velocities and hull strength.  Floats are hashed by their bits, so any difference at all shows up.
+ */
+uint obj_state_hash()
+{
+	uint hash = 2166136261u;
+	object *objp;
+
+	for ( objp = GET_FIRST(&obj_used_list); objp != END_OF_LIST(&obj_used_list); objp = GET_NEXT(objp) ) {
+		hash = obj_hash_bytes(hash, &objp->type, sizeof(objp->type));
+		hash = obj_hash_bytes(hash, &objp->signature, sizeof(objp->signature));
+		hash = obj_hash_bytes(hash, &objp->pos, sizeof(objp->pos));
+		hash = obj_hash_bytes(hash, &objp->orient, sizeof(objp->orient));
+		hash = obj_hash_bytes(hash, &objp->phys_info.vel, sizeof(objp->phys_info.vel));
+		hash = obj_hash_bytes(hash, &objp->phys_info.rotvel, sizeof(objp->phys_info.rotvel));
+		hash = obj_hash_bytes(hash, &objp->hull_strength, sizeof(objp->hull_strength));
+	}
+
+	return hash;
+}
+
 MONITOR( NumObjects )
 
 /**
@@ -1390,7 +1430,7 @@ void obj_move_all(float frametime)
 		obj_move_all_post(objp, frametime);
 
 		// Equipment script processing
-		if (objp->type == OBJ_SHIP) {
+		if (objp->type == OBJ_SHIP && Script_system.IsActiveAction(CHA_ONWPEQUIPPED)) {
 			ship* shipp = &Ships[objp->instance];
 			object* target;
 
@@ -1469,6 +1509,10 @@ void obj_move_all(float frametime)
 	// update artillery locking info now
 	ship_update_artillery_lock();
 
+	if ( Log_state_hash ) {
+		nprintf(("StateHash", "Frame %d: frametime %08x, state %08x\n", Simulation_framecount, Frametime, obj_state_hash()));
+	}
+
 //	mprintf(("moved all objects\n"));
 }
 
@@ -1487,9 +1531,13 @@ void obj_render(object *obj)
 
 	MONITOR_INC( NumObjectsRend, 1 );	
 
+	// only bother with the hook variables if some script is listening
+	bool scripted = Script_system.IsActiveAction(CHA_OBJECTRENDER);
+
 	//WMC - By definition, override statements are executed before the actual statement
-	Script_system.SetHookObject("Self", obj);
-	if(!Script_system.IsConditionOverride(CHA_OBJECTRENDER, obj))
+	if (scripted)
+		Script_system.SetHookObject("Self", obj);
+	if(!scripted || !Script_system.IsConditionOverride(CHA_OBJECTRENDER, obj))
 	{
 		switch( obj->type )	{
 		case OBJ_NONE:
@@ -1542,8 +1590,10 @@ void obj_render(object *obj)
 		}
 	}
 
-	Script_system.RunCondition(CHA_OBJECTRENDER, '\0', NULL, obj);
-	Script_system.RemHookVar("Self");
+	if (scripted) {
+		Script_system.RunCondition(CHA_OBJECTRENDER, '\0', NULL, obj);
+		Script_system.RemHookVar("Self");
+	}
 }
 
 void obj_init_all_ships_physics()
@@ -243,6 +243,9 @@ void obj_render_all(void (*render_function)(object *objp), bool* render_viewer_l
 //move all objects for the current frame
 void obj_move_all(float frametime);		// moves all objects
 
+// hash of the simulation state of all objects, for spotting where two runs diverge
+uint obj_state_hash();
+
 //move an object for the current frame
 void obj_move_one(object * obj, float frametime);
 
@@ -16,7 +16,7 @@
 #include "nebula/neb.h"
 #include "ship/ship.h"
 
-#include <list>
+#include <algorithm>
 #include "weapon/weapon.h"
 #include "debris/debris.h"
 #include "asteroid/asteroid.h"
@@ -25,81 +25,56 @@
 typedef struct sorted_obj {
 	object			*obj;					// a pointer to the original object
 	float			z, min_z, max_z;		// The object's z values relative to viewer
+	int				model_num;				// model used to render the object, or -1; the primary sort key
 
 	sorted_obj() :
-		obj(NULL), z(0.0f), min_z(0.0f), max_z(1.0f)
+		obj(NULL), z(0.0f), min_z(0.0f), max_z(1.0f), model_num(-1)
 	{
 	}
 
 	bool operator < (const sorted_obj &other) const;
 } sorted_obj;
 
+// Objects are grouped by model to minimize state changes, and drawn far to near within each group.
+// The last tiebreak keeps the order identical to the stable sort of object index order we used to do.
 inline bool sorted_obj::operator < (const sorted_obj &other) const
 {
-	int model_num_a = -1;
-	int model_num_b = -1;
+	if ( model_num != other.model_num ) {
+		return model_num < other.model_num;
+	}
 
-	if ( obj->type == OBJ_SHIP ) {
-		ship_info *sip = &Ship_info[Ships[obj->instance].ship_info_index];
+	if ( max_z != other.max_z ) {
+		return (max_z > other.max_z);
+	}
 
-		model_num_a = sip->model_num;
-	} else if ( obj->type == OBJ_WEAPON ){
-		weapon_info *wip;
-		weapon *wp;
+	return obj < other.obj;
+}
 
-		wp = &Weapons[obj->instance];
-		wip = &Weapon_info[Weapons[obj->instance].weapon_info_index];
+// the model an object will be rendered with, or -1 if it isn't drawn with a model
+static int obj_sort_model_num(object *obj)
+{
+	if ( obj->type == OBJ_SHIP ) {
+		return Ship_info[Ships[obj->instance].ship_info_index].model_num;
+	} else if ( obj->type == OBJ_WEAPON ) {
+		weapon_info *wip = &Weapon_info[Weapons[obj->instance].weapon_info_index];
 
 		if ( wip->render_type == WRT_POF ) {
-			model_num_a = wip->model_num;
+			return wip->model_num;
 		}
 	} else if ( obj->type == OBJ_DEBRIS ) {
-		debris		*db;
-
-		db = &Debris[obj->instance];
-		model_num_a = db->model_num;
+		return Debris[obj->instance].model_num;
 	} else if ( obj->type == OBJ_ASTEROID ) {
-		asteroid		*asp;
+		asteroid *asp = &Asteroids[obj->instance];
 
-		asp = &Asteroids[obj->instance];
-		model_num_a = Asteroid_info[asp->asteroid_type].model_num[asp->asteroid_subtype];
+		return Asteroid_info[asp->asteroid_type].model_num[asp->asteroid_subtype];
 	}
 
-	if ( other.obj->type == OBJ_SHIP ) {
-		ship_info *sip = &Ship_info[Ships[other.obj->instance].ship_info_index];
-
-		model_num_b = sip->model_num;
-	} else if ( other.obj->type == OBJ_WEAPON ){
-		weapon_info *wip;
-		weapon *wp;
-
-		wp = &Weapons[other.obj->instance];
-		wip = &Weapon_info[Weapons[other.obj->instance].weapon_info_index];
-
-		if ( wip->render_type == WRT_POF ) {
-			model_num_b = wip->model_num;
-		}
-	} else if ( other.obj->type == OBJ_DEBRIS ) {
-		debris		*db;
-
-		db = &Debris[other.obj->instance];
-		model_num_b = db->model_num;
-	} else if ( other.obj->type == OBJ_ASTEROID ) {
-		asteroid		*asp;
-
-		asp = &Asteroids[other.obj->instance];
-		model_num_b = Asteroid_info[asp->asteroid_type].model_num[asp->asteroid_subtype];
-	}
-
-	if ( model_num_a == model_num_b ) {
-		return (max_z > other.max_z);
-	}
-
-	return model_num_a < model_num_b;
+	return -1;
 }
 
 
-SCP_list<sorted_obj> Sorted_objects;
+// kept between frames so the storage only has to grow once
+SCP_vector<sorted_obj> Sorted_objects;
 SCP_vector<object*> effect_ships; 
 
 // Used to (fairly) quicky find the 8 extreme
@@ -160,6 +135,8 @@ inline bool obj_render_is_model(object *obj)
 		|| obj->type == OBJ_JUMP_NODE;
 }
 
+MONITOR( NumModelChanges )
+
 // Sorts all the objects by Z and renders them
 extern int Fred_active;
 extern int Cmdline_nohtl;
@@ -201,6 +178,7 @@ void obj_render_all(void (*render_function)(object *objp), bool *draw_viewer_las
 					
 				osp.min_z = osp.z - objp->radius;
 				osp.max_z = osp.z + objp->radius;
+				osp.model_num = obj_sort_model_num(objp);
 
 				Sorted_objects.push_back(osp);
 
@@ -220,7 +198,7 @@ void obj_render_all(void (*render_function)(object *objp), bool *draw_viewer_las
 	if ( Sorted_objects.empty() )
 		return;
 
-	Sorted_objects.sort();
+	std::sort(Sorted_objects.begin(), Sorted_objects.end());
 
 #ifdef DYN_CLIP_DIST
 	if (!Cmdline_nohtl)
@@ -241,7 +219,8 @@ void obj_render_all(void (*render_function)(object *objp), bool *draw_viewer_las
 
 	// now draw them
 	// only render models in this loop in order to minimize state changes
-	SCP_list<sorted_obj>::iterator os;
+	SCP_vector<sorted_obj>::iterator os;
+	int last_model_num = -1;
 	for (os = Sorted_objects.begin(); os != Sorted_objects.end(); ++os) {
 		object *obj = os->obj;
 
@@ -275,6 +254,11 @@ void obj_render_all(void (*render_function)(object *objp), bool *draw_viewer_las
 		}
 
 		if ( obj_render_is_model(obj) ) {
+			if ( os->model_num != last_model_num ) {
+				MONITOR_INC(NumModelChanges, 1);
+				last_model_num = os->model_num;
+			}
+
 			if( (obj->type == OBJ_SHIP) && Ships[obj->instance].shader_effect_active )
 				effect_ships.push_back(obj);
 			else 
@@ -14146,6 +14146,27 @@ static int ade_return_hack(lua_State *L)
 
 	return num;
 }
+#ifndef NDEBUG
+MONITOR( NumLuaAllocs )
+MONITOR( NumLuaFrees )
+
+//Same as the stock allocator, but counts calls so GC pressure shows up in the monitor
+static void *ade_lua_alloc(void *ud, void *ptr, size_t osize, size_t nsize)
+{
+	if(nsize == 0)
+	{
+		if(ptr != NULL)
+			MONITOR_INC( NumLuaFrees, 1 );
+		free(ptr);
+		return NULL;
+	}
+
+	if(ptr == NULL)
+		MONITOR_INC( NumLuaAllocs, 1 );
+	return realloc(ptr, nsize);
+}
+#endif
+
 //Inits LUA
 //Note that "libraries" must end with a {NULL, NULL}
 //element
@@ -14185,6 +14206,9 @@ int script_state::CreateLuaState()
 	//*****SET DEBUG HOOKS
 #ifndef NDEBUG
 	lua_sethook(L, ade_debug_ret, LUA_MASKRET, 0);
+
+	//Both allocators use realloc/free, so it's safe to swap now
+	lua_setallocf(L, ade_lua_alloc, NULL);
 #endif
 
 	//*****INITIALIZE ADE
@@ -25,6 +25,7 @@
 #include "ship/ship.h"
 #include "weapon/weapon.h"
 #include "globalincs/version.h"
+#include "io/timer.h"
 
 
 
@@ -59,6 +60,24 @@ static int Parsing_paused = 0;
 void allocate_mission_text(int size);
 static int Mission_text_size = 0;
 
+// running totals for table/mission text read through read_file_text(), for load time reporting
+int Parse_text_bytes = 0;
+int Parse_text_usecs = 0;
+
+// ASCII case folding for parse_token_cmp(), matching what strnicmp does in the C locale
+#define PARSE_FOLD(c)	( (((c) >= 'A') && ((c) <= 'Z')) ? ((c) | 0x20) : (c) )
+
+// Compare pstr against the text at Mp, ignoring case.  Returns 0 on a match, like strnicmp.
+// Nearly every token probe fails on the very first character, so reject on that before
+// paying for a full strnicmp.
+static inline int parse_token_cmp(const char *pstr, size_t len)
+{
+	if ( len && (PARSE_FOLD((ubyte)*pstr) != PARSE_FOLD((ubyte)*Mp)) )
+		return 1;
+
+	return strnicmp(pstr, Mp, len);
+}
+
 
 //	Return true if this character is white space, else false.
 int is_white_space(char ch)
@@ -386,11 +405,11 @@ int skip_to_string(char *pstr, char *end)
 	if (end)
 		len2 = strlen(end);
 
-	while ((*Mp != EOF_CHAR) && strnicmp(pstr, Mp, len)) {
+	while ((*Mp != EOF_CHAR) && parse_token_cmp(pstr, len)) {
 		if (end && *Mp == '#')
 			return 0;
 
-		if (end && !strnicmp(end, Mp, len2))
+		if (end && !parse_token_cmp(end, len2))
 			return -1;
 
 		advance_to_eoln(NULL);
@@ -417,11 +436,11 @@ int skip_to_start_of_string(char *pstr, char *end)
 	else
 		endlen = 0;
 
-	while ( (*Mp != EOF_CHAR) && strnicmp(pstr, Mp, len) ) {
+	while ( (*Mp != EOF_CHAR) && parse_token_cmp(pstr, len) ) {
 		if (end && *Mp == '#')
 			return 0;
 
-		if (end && !strnicmp(end, Mp, endlen))
+		if (end && !parse_token_cmp(end, endlen))
 			return 0;
 
 		advance_to_eoln(NULL);
@@ -447,11 +466,11 @@ int skip_to_start_of_string_either(char *pstr1, char *pstr2, char *end)
 	else
 		endlen = 0;
 
-	while ( (*Mp != EOF_CHAR) && strnicmp(pstr1, Mp, len1) && strnicmp(pstr2, Mp, len2) ) {
+	while ( (*Mp != EOF_CHAR) && parse_token_cmp(pstr1, len1) && parse_token_cmp(pstr2, len2) ) {
 		if (end && *Mp == '#')
 			return 0;
 
-		if (end && !strnicmp(end, Mp, endlen))
+		if (end && !parse_token_cmp(end, endlen))
 			return 0;
 
 		advance_to_eoln(NULL);
@@ -476,7 +495,7 @@ int required_string(char *pstr)
 
 	ignore_white_space();
 
-	while (strnicmp(pstr, Mp, strlen(pstr)) && (count < RS_MAX_TRIES)) {
+	while (parse_token_cmp(pstr, strlen(pstr)) && (count < RS_MAX_TRIES)) {
 		error_display(1, "Missing required token: [%s]. Found [%.32s] %s instead.\n", pstr, next_tokens(), parse_error_text);
 		advance_to_eoln(NULL);
 		ignore_white_space();
@@ -523,7 +542,7 @@ int check_for_string(const char *pstr)
 {
 	ignore_white_space();
 
-	if (!strnicmp(pstr, Mp, strlen(pstr)))
+	if (!parse_token_cmp(pstr, strlen(pstr)))
 		return 1;
 
 	return 0;
@@ -532,7 +551,7 @@ int check_for_string(const char *pstr)
 // like check for string, but doesn't skip past any whitespace
 int check_for_string_raw(const char *pstr)
 {
-	if (!strnicmp(pstr, Mp, strlen(pstr)))
+	if (!parse_token_cmp(pstr, strlen(pstr)))
 		return 1;
 
 	return 0;
@@ -546,7 +565,7 @@ int optional_string(const char *pstr)
 	ignore_white_space();
 //	mprintf(("lookint for optional string %s",pstr));
 
-	if (!strnicmp(pstr, Mp, strlen(pstr))) {
+	if (!parse_token_cmp(pstr, strlen(pstr))) {
 		Mp += strlen(pstr);
 //		mprintf((", found it\n"));
 		return 1;
@@ -560,10 +579,10 @@ int optional_string_either(char *str1, char *str2)
 {
 	ignore_white_space();
 
-	if ( !strnicmp(str1, Mp, strlen(str1)) ) {
+	if ( !parse_token_cmp(str1, strlen(str1)) ) {
 		Mp += strlen(str1);
 		return 0;
-	} else if ( !strnicmp(str2, Mp, strlen(str2)) ) {
+	} else if ( !parse_token_cmp(str2, strlen(str2)) ) {
 		Mp += strlen(str2);
 		return 1;
 	}
@@ -580,8 +599,8 @@ int required_string_fred(char *pstr, char *end)
 		return 0;
 
 	ignore_white_space();
-	while (*Mp != EOF_CHAR && strnicmp(pstr, Mp, strlen(pstr))) {
-		if ((*Mp == '#') || (end && !strnicmp(end, Mp, strlen(end)))) {
+	while (*Mp != EOF_CHAR && parse_token_cmp(pstr, strlen(pstr))) {
+		if ((*Mp == '#') || (end && !parse_token_cmp(end, strlen(end)))) {
 			Mp = NULL;
 			break;
 		}
@@ -617,9 +636,9 @@ int optional_string_fred(char *pstr, char *end, char *end2)
 		return 0;
 
 	ignore_white_space();
-	while ((*Mp != EOF_CHAR) && strnicmp(pstr, Mp, strlen(pstr))) {
-		if ((*Mp == '#') || (end && !strnicmp(end, Mp, strlen(end))) ||
-			(end2 && !strnicmp(end2, Mp, strlen(end2)))) {
+	while ((*Mp != EOF_CHAR) && parse_token_cmp(pstr, strlen(pstr))) {
+		if ((*Mp == '#') || (end && !parse_token_cmp(end, strlen(end))) ||
+			(end2 && !parse_token_cmp(end2, strlen(end2)))) {
 			Mp = NULL;
 			break;
 		}
@@ -651,11 +670,11 @@ int required_string_either(char *str1, char *str2)
 	ignore_white_space();
 
 	while (count < RS_MAX_TRIES) {
-		if (strnicmp(str1, Mp, strlen(str1)) == 0) {
+		if (parse_token_cmp(str1, strlen(str1)) == 0) {
 			// Mp += strlen(str1);
 			diag_printf("Found required string [%s]\n%s", token_found = str1, parse_error_text);
 			return 0;
-		} else if (strnicmp(str2, Mp, strlen(str2)) == 0) {
+		} else if (parse_token_cmp(str2, strlen(str2)) == 0) {
 			// Mp += strlen(str2);
 			diag_printf("Found required string [%s]\n%s", token_found = str2, parse_error_text);
 			return 1;
@@ -688,15 +707,15 @@ int required_string_3(char *str1, char *str2, char *str3)
 	ignore_white_space();
 
 	while (count < RS_MAX_TRIES) {
-		if (strnicmp(str1, Mp, strlen(str1)) == 0) {
+		if (parse_token_cmp(str1, strlen(str1)) == 0) {
 			// Mp += strlen(str1);
 			diag_printf("Found required string [%s]\n", token_found = str1);
 			return 0;
-		} else if (strnicmp(str2, Mp, strlen(str2)) == 0) {
+		} else if (parse_token_cmp(str2, strlen(str2)) == 0) {
 			// Mp += strlen(str2);
 			diag_printf("Found required string [%s]\n", token_found = str2);
 			return 1;
-		} else if (strnicmp(str3, Mp, strlen(str3)) == 0) {
+		} else if (parse_token_cmp(str3, strlen(str3)) == 0) {
 			diag_printf("Found required string [%s]\n", token_found = str3);
 			return 2;
 		}
@@ -719,18 +738,18 @@ int required_string_4(char *str1, char *str2, char *str3, char *str4)
 	ignore_white_space();
 	
 	while (count < RS_MAX_TRIES) {
-		if (strnicmp(str1, Mp, strlen(str1)) == 0) {
+		if (parse_token_cmp(str1, strlen(str1)) == 0) {
 			// Mp += strlen(str1);
 			diag_printf("Found required string [%s]\n", token_found = str1);
 			return 0;
-		} else if (strnicmp(str2, Mp, strlen(str2)) == 0) {
+		} else if (parse_token_cmp(str2, strlen(str2)) == 0) {
 			// Mp += strlen(str2);
 			diag_printf("Found required string [%s]\n", token_found = str2);
 			return 1;
-		} else if (strnicmp(str3, Mp, strlen(str3)) == 0) {
+		} else if (parse_token_cmp(str3, strlen(str3)) == 0) {
 			diag_printf("Found required string [%s]\n", token_found = str3);
 			return 2;
-		} else if (strnicmp(str4, Mp, strlen(str4)) == 0) {
+		} else if (parse_token_cmp(str4, strlen(str4)) == 0) {
 			diag_printf("Found required string [%s]\n", token_found = str4);
 			return 3;
 		}
@@ -751,12 +770,12 @@ int required_string_either_fred(char *str1, char *str2)
 	ignore_white_space();
 
 	while (*Mp != EOF_CHAR) {
-		if (!strnicmp(str1, Mp, strlen(str1))) {
+		if (!parse_token_cmp(str1, strlen(str1))) {
 			// Mp += strlen(str1);
 			diag_printf("Found required string [%s]\n", token_found = str1);
 			return fred_parse_flag = 0;
 		
-		} else if (!strnicmp(str2, Mp, strlen(str2))) {
+		} else if (!parse_token_cmp(str2, strlen(str2))) {
 			// Mp += strlen(str2);
 			diag_printf("Found required string [%s]\n", token_found = str2);
 			return fred_parse_flag = 1;
@@ -1735,7 +1754,10 @@ int strip_comments(char *line, int in_multiline_comment)
 
 	// special version-specific comment
 	// formatted like e.g. ;;FSO 3.7.0;;
-	ch = stristr(line, ";;FSO ");
+	// (most lines have no ';' at all, so don't bother with the much slower stristr for those)
+	ch = strchr(line, ';');
+	if (ch != NULL)
+		ch = stristr(ch, ";;FSO ");
 	if (ch != NULL)
 	{
 		int major, minor, build;
@@ -1920,6 +1942,8 @@ void read_file_text(char *filename, int mode, char *processed_text, char *raw_te
 		Error(LOCATION, "ERROR: Neither processed_text nor raw_text may be NULL when parsing is paused!!\n");
 	}
 
+	int start_time = timer_get_microseconds();
+
 	// read the raw text
 	read_raw_file_text(filename, mode, raw_text);
 
@@ -1929,8 +1953,13 @@ void read_file_text(char *filename, int mode, char *processed_text, char *raw_te
 	if (raw_text == NULL)
 		raw_text = Mission_text_raw;
 
+	// (must be measured now; processing overwrites the terminator with EOF_CHAR)
+	Parse_text_bytes += strlen(raw_text);
+
 	// process it (strip comments)
 	process_raw_file_text(processed_text, raw_text);
+
+	Parse_text_usecs += timer_get_microseconds() - start_time;
 }
 
 // Goober5000
@@ -3600,6 +3629,41 @@ stristr_continue_outer_loop:
 	return NULL;
 }
 
+// case-insensitive FNV-1a hash, so that two strings which compare equal under stricmp hash the same
+uint hash_string_nocase(const char *str)
+{
+	uint hash = 2166136261u;
+
+	Assert(str);
+
+	for ( ; *str; str++) {
+		hash ^= PARSE_FOLD((ubyte)*str);
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+// same as hash_string_nocase(), but leaves off the trailing 's' that subsystem_stricmp() ignores
+uint hash_subsystem_name(const char *str)
+{
+	uint hash = 2166136261u;
+	int len;
+
+	Assert(str);
+
+	len = strlen(str);
+	if (len && (str[len-1] == 's'))
+		len--;
+
+	for (int i = 0; i < len; i++) {
+		hash ^= PARSE_FOLD((ubyte)str[i]);
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
 // Goober5000
 bool can_construe_as_integer(const char *text)
 {
@@ -222,6 +222,12 @@ extern SCP_string& replace_all(SCP_string& context, const char* from, const char
 // Goober5000 (why is this not in the C library?)
 extern char *stristr(const char *str, const char *substr);
 
+// hash that is consistent with stricmp, for indexing name lookups
+extern uint hash_string_nocase(const char *str);
+
+// hash that is consistent with subsystem_stricmp
+extern uint hash_subsystem_name(const char *str);
+
 // Goober5000 (ditto)
 extern bool can_construe_as_integer(const char *text);
 
@@ -254,6 +260,10 @@ extern int parse_modular_table(char *name_check, void (*parse_callback)(char *fi
 // to know that we are parsing a modular table
 extern bool Parsing_modular_table;
 
+// load time statistics for read_file_text()
+extern int Parse_text_bytes;
+extern int Parse_text_usecs;
+
 //Karajorma - Parses mission and campaign ship loadouts. 
 int stuff_loadout_list (int *ilp, int max_ints, int lookup_type);
 int get_string_or_variable (char *str);
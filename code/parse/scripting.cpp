@@ -888,6 +888,14 @@ bool script_state::IsConditionOverride(int action, object *objp)
 	return false;
 }
 
+//Lets callers skip setting up hook variables when nothing is listening for an action
+bool script_state::IsActiveAction(int action_id)
+{
+	Assert(action_id >= 0 && action_id <= CHA_LAST);
+
+	return ActiveActions[action_id];
+}
+
 void script_state::EndFrame()
 {
 	EndLuaFrame();
@@ -901,6 +909,8 @@ void script_state::Clear()
 	//Don't close this yet
 	LuaState = NULL;
 	LuaLibs = NULL;
+
+	memset(ActiveActions, 0, sizeof(ActiveActions));
 }
 
 script_state::script_state(char *name)
@@ -911,6 +921,8 @@ script_state::script_state(char *name)
 
 	LuaState = NULL;
 	LuaLibs = NULL;
+
+	memset(ActiveActions, 0, sizeof(ActiveActions));
 }
 
 script_state& script_state::operator=(script_state &in)
@@ -1341,7 +1353,10 @@ bool script_state::ParseCondition(char *filename)
 
 		//Add the action
 		if(chp->AddAction(sat))
+		{
 			actions_added = true;
+			ActiveActions[sat.action_type] = true;
+		}
 	}
 
 	if(!actions_added)
@@ -69,6 +69,7 @@ struct image_desc
 #define CHA_ONTURRETFIRED	27
 #define CHA_PRIMARYFIRE		28
 #define CHA_SECONDARYFIRE	29
+#define CHA_LAST			CHA_SECONDARYFIRE
 
 // management stuff
 void scripting_state_init();
@@ -121,6 +122,7 @@ private:
 	//Utility variables
 	SCP_vector<image_desc> ScriptImages;
 	SCP_vector<ConditionedHook> ConditionalHooks;
+	bool ActiveActions[CHA_LAST+1];		// actions that at least one conditional hook responds to
 
 private:
 
@@ -183,6 +185,7 @@ public:
 	bool IsOverride(script_hook &hd);
 	int RunCondition(int condition, char format='\0', void *data=NULL, struct object *objp = NULL, int more_data = 0);
 	bool IsConditionOverride(int action, object *objp=NULL);
+	bool IsActiveAction(int action_id);
 
 	//*****Other functions
 	void EndFrame();
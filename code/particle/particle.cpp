@@ -25,6 +25,9 @@
 int Num_particles = 0;
 static SCP_vector<particle*> Particles;
 
+// dead particles wait here to be reused, so busy scenes don't hit the heap for every spark
+static SCP_vector<particle*> Particle_free_list;
+
 int Anim_bitmap_id_fire = -1;
 int Anim_num_frames_fire = -1;
 
@@ -81,6 +84,31 @@ void particle_close()
 		delete *p;
 	}
 	Particles.clear();
+
+	for (SCP_vector<particle*>::iterator p = Particle_free_list.begin(); p != Particle_free_list.end(); ++p)
+	{
+		delete *p;
+	}
+	Particle_free_list.clear();
+}
+
+static particle *particle_alloc()
+{
+	if (Particle_free_list.empty())
+		return new particle();
+
+	particle *part = Particle_free_list.back();
+	Particle_free_list.pop_back();
+
+	*part = particle();
+	return part;
+}
+
+// signature is cleared so any scripting handles to this particle go invalid
+static void particle_free(particle *part)
+{
+	part->signature = 0;
+	Particle_free_list.push_back(part);
 }
 
 void particle_page_in()
@@ -113,7 +141,7 @@ particle *particle_create( particle_info *pinfo )
 		return NULL;
 	}
 
-	particle* new_particle = new particle();
+	particle* new_particle = particle_alloc();
 	int fps = 1;
 	
 	new_particle->pos = pinfo->pos;
@@ -134,7 +162,7 @@ particle *particle_create( particle_info *pinfo )
 		case PARTICLE_BITMAP_PERSISTENT: {
 			if (pinfo->optional_data < 0) {
 				Int3();
-				delete new_particle;
+				particle_free(new_particle);
 				return NULL;
 			}
 
@@ -150,7 +178,7 @@ particle *particle_create( particle_info *pinfo )
 
 		case PARTICLE_FIRE: {
 			if (Anim_bitmap_id_fire < 0) {
-				delete new_particle;
+				particle_free(new_particle);
 				return NULL;
 			}
 
@@ -162,7 +190,7 @@ particle *particle_create( particle_info *pinfo )
 
 		case PARTICLE_SMOKE: {
 			if (Anim_bitmap_id_smoke < 0) {
-				delete new_particle;
+				particle_free(new_particle);
 				return NULL;
 			}
 
@@ -174,7 +202,7 @@ particle *particle_create( particle_info *pinfo )
 
 		case PARTICLE_SMOKE2: {
 			if (Anim_bitmap_id_smoke2 < 0) {
-				delete new_particle;
+				particle_free(new_particle);
 				return NULL;
 			}
 
@@ -279,8 +307,7 @@ void particle_move_all(float frametime)
 
 		if (remove_particle)
 		{
-			part->signature = 0;
-			delete part;
+			particle_free(part);
 
 			// if we're sitting on the very last particle, popping-back will invalidate the iterator!
 			if (p + 1 == Particles.end())
@@ -313,8 +340,7 @@ void particle_kill_all()
 
 	for (SCP_vector<particle*>::iterator p = Particles.begin(); p != Particles.end(); ++p)
 	{
-		(*p)->signature = 0;
-		delete *p;
+		particle_free(*p);
 	}
 	Particles.clear();
 }
@@ -150,6 +150,12 @@ ccodes g3_check_codes(int nv,vertex **pointlist);
  */
 ubyte g3_rotate_vertex(vertex *dest,vec3d *src);
 
+/**
+ * Rotates count points, same as calling g3_rotate_vertex() on each of them.
+ * Takes a list of pointers since model vertex data is interleaved with normals.
+ */
+void g3_rotate_vertices(vertex *dest, vec3d **src, int count);
+
 /**
  * Same as above, only ignores the current instancing
  */
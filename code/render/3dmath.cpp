@@ -12,6 +12,7 @@
 #include "graphics/2d.h"
 #include "hud/hud.h" //For HUD_offset_*
 #include "render/3dinternal.h"
+#include "math/staticrand.h"
 
 #define MIN_Z 0.0f
 
@@ -152,6 +153,97 @@ ubyte g3_rotate_vertex(vertex *dest,vec3d *src)
 #endif
 }	
 
+void g3_rotate_vertices(vertex *dest, vec3d **src, int count)
+{
+	// local copies of the view transform, so the compiler doesn't have to reload
+	// them after every store into dest
+	vec3d pos = View_position;
+	matrix m = View_matrix;
+	int user_clip = G3_user_clip;
+	float tx, ty, tz, x,y,z;
+	ubyte codes;
+	int i;
+
+	MONITOR_INC( NumRotations, count );
+
+	for (i = 0; i < count; i++, dest++) {
+		// same operations, in the same order, as g3_rotate_vertex() so the results match exactly
+		tx = src[i]->xyz.x - pos.xyz.x;
+		ty = src[i]->xyz.y - pos.xyz.y;
+		tz = src[i]->xyz.z - pos.xyz.z;
+
+		x = tx * m.vec.rvec.xyz.x;
+		x += ty * m.vec.rvec.xyz.y;
+		x += tz * m.vec.rvec.xyz.z;
+
+		y = tx * m.vec.uvec.xyz.x;
+		y += ty * m.vec.uvec.xyz.y;
+		y += tz * m.vec.uvec.xyz.z; //-V537
+
+		z = tx * m.vec.fvec.xyz.x;
+		z += ty * m.vec.fvec.xyz.y;
+		z += tz * m.vec.fvec.xyz.z;
+
+		codes = 0;
+
+		if (x > z)			codes |= CC_OFF_RIGHT;
+		if (x < -z)			codes |= CC_OFF_LEFT;
+		if (y > z)			codes |= CC_OFF_TOP;
+		if (y < -z)			codes |= CC_OFF_BOT;
+		if (z < MIN_Z )		codes |= CC_BEHIND;
+
+		dest->world.xyz.x = x;
+		dest->world.xyz.y = y;
+		dest->world.xyz.z = z;
+
+		if ( user_clip && g3_point_behind_user_plane(&dest->world) )	{
+			codes |= CC_OFF_USER;
+		}
+
+		dest->codes = codes;
+
+		dest->flags = 0;	// not projected
+	}
+}
+
+#define ROTATE_CHECK_POINTS	256
+
+DCF(rotate_check, "Checks that g3_rotate_vertices() matches g3_rotate_vertex() for the current view")
+{
+	vec3d points[ROTATE_CHECK_POINTS];
+	vec3d *point_list[ROTATE_CHECK_POINTS];
+	vertex batched[ROTATE_CHECK_POINTS];
+	vertex single;
+	int i, mismatches = 0;
+
+	if ( Dc_command )	{
+		// points scattered around the viewer, some of them behind it and off every side
+		for (i = 0; i < ROTATE_CHECK_POINTS; i++) {
+			points[i].xyz.x = View_position.xyz.x + static_randf_range(3*i, -1000.0f, 1000.0f);
+			points[i].xyz.y = View_position.xyz.y + static_randf_range(3*i+1, -1000.0f, 1000.0f);
+			points[i].xyz.z = View_position.xyz.z + static_randf_range(3*i+2, -1000.0f, 1000.0f);
+			point_list[i] = &points[i];
+		}
+
+		g3_rotate_vertices(batched, point_list, ROTATE_CHECK_POINTS);
+
+		for (i = 0; i < ROTATE_CHECK_POINTS; i++) {
+			g3_rotate_vertex(&single, &points[i]);
+
+			if ( (single.world.xyz.x != batched[i].world.xyz.x) || (single.world.xyz.y != batched[i].world.xyz.y)
+				|| (single.world.xyz.z != batched[i].world.xyz.z) || (single.codes != batched[i].codes) ) {
+				mismatches++;
+			}
+		}
+
+		dc_printf( "%d of %d points differ between g3_rotate_vertices() and g3_rotate_vertex()\n", mismatches, ROTATE_CHECK_POINTS );
+	}
+
+	if ( Dc_help )	{
+		dc_printf( "Usage: rotate_check\nRotates a set of points around the viewer both one at a time and as a list, and reports any that differ.\n" );
+	}
+}
+
 
 ubyte g3_rotate_faraway_vertex(vertex *dest,vec3d *src)
 {	
@@ -4328,6 +4328,18 @@ void ship_init()
 
 			ship_parse_post_cleanup();
 
+#ifndef NDEBUG
+			// the name index has to give the same answer as a plain linear search
+			for (idx = 0; idx < Num_ship_classes; idx++) {
+				int first;
+
+				for (first = 0; stricmp(Ship_info[first].name, Ship_info[idx].name); first++)
+					;
+
+				Assertion(ship_info_lookup(Ship_info[idx].name) == first, "Ship class name index disagrees with a linear search for '%s'", Ship_info[idx].name);
+			}
+#endif
+
 			ships_inited = 1;
 
 			// cleanup
@@ -4417,6 +4429,15 @@ static int ship_allocate_subsystems(int num_so, bool page_in = false)
 	return 1;
 }
 
+// Each ship's subsys_list as an array, indexed by ship number, so a subsystem can be reached by
+// its position without walking the list.  Rebuilt by subsys_set() and emptied by ship_subsystems_delete().
+static SCP_vector<ship_subsys*> Ship_subsys_array[MAX_SHIPS];
+
+// Per ship class, the first list position of each subsystem name, keyed by hash_subsystem_name().
+// Filled in from the first ship of the class that is looked up, and reset between levels.
+static SCP_vector< SCP_hash_map<uint, int> > Ship_subsys_name_index;
+static SCP_vector<bool> Ship_subsys_name_indexed;
+
 /**
  * This will get called at the start of each level.
  */
@@ -4427,10 +4448,13 @@ void ship_level_init()
 	// Reset everything between levels
 	Ships_exited.clear(); 
 	Ships_exited.reserve(100);
+	Ship_subsys_name_index.clear();
+	Ship_subsys_name_indexed.clear();
 	for (i=0; i<MAX_SHIPS; i++ )
 	{
 		Ships[i].ship_name[0] = '\0';
 		Ships[i].objnum = -1;
+		Ship_subsys_array[i].clear();
 	}
 
 	Num_wings = 0;
@@ -5274,6 +5298,31 @@ void ship_copy_subsystem_fixup(ship_info *sip)
 }
 
 
+// returns NULL for a ship that isn't in Ships[], such as the observer's copy in Hud_obs_ship
+static SCP_vector<ship_subsys*> *ship_subsys_array(ship *shipp)
+{
+	int shipnum = SHIP_INDEX(shipp);
+
+	if ( (shipnum < 0) || (shipnum >= MAX_SHIPS) )
+		return NULL;
+
+	return &Ship_subsys_array[shipnum];
+}
+
+static void ship_subsys_array_rebuild(ship *shipp)
+{
+	SCP_vector<ship_subsys*> *array = ship_subsys_array(shipp);
+	ship_subsys *ss;
+
+	if (array == NULL)
+		return;
+
+	array->clear();
+	for (ss = GET_FIRST(&shipp->subsys_list); ss != END_OF_LIST(&shipp->subsys_list); ss = GET_NEXT(ss)) {
+		array->push_back(ss);
+	}
+}
+
 /**
  * Set subsystem
  *
@@ -5291,6 +5340,7 @@ int subsys_set(int objnum, int ignore_subsys_info)
 	// set up the subsystems for this ship.  walk through list of subsystems in the ship-info array.
 	// for each subsystem, get a new ship_subsys instance and set up the pointers and other values
 	list_init ( &shipp->subsys_list );								// initialize the ship's list of subsystems
+	ship_subsys_array_rebuild( shipp );
 
 	// make sure to have allocated the number of subsystems we require
 	if (!ship_allocate_subsystems( sinfo->n_subsystems )) {
@@ -5530,6 +5580,8 @@ int subsys_set(int objnum, int ignore_subsys_info)
 		ship_recalc_subsys_strength( shipp );
 	}
 
+	ship_subsys_array_rebuild( shipp );
+
 	// Fix up animation code references
 	for (i = 0; i < sinfo->n_subsystems; i++) {
 		for (j = 0; j < sinfo->subsystems[i].n_triggers; j++) {
@@ -6566,6 +6618,10 @@ void ship_end_render_cockpit_display(int cockpit_display_num)
 
 void ship_subsystems_delete(ship *shipp)
 {
+	SCP_vector<ship_subsys*> *array = ship_subsys_array(shipp);
+	if (array != NULL)
+		array->clear();
+
 	if ( NOT_EMPTY(&shipp->subsys_list) )
 	{
 		ship_subsys *systemp, *temp;
@@ -10479,7 +10535,7 @@ int ship_fire_primary(object * obj, int stream_weapons, int force)
 		}
 	}
 
-	if (has_fired) {
+	if (has_fired && (Script_system.IsActiveAction(CHA_ONWPFIRED) || Script_system.IsActiveAction(CHA_PRIMARYFIRE))) {
 		object *objp = &Objects[shipp->objnum];
 		object* target;
 		if (Ai_info[shipp->ai_index].target_objnum != -1)
@@ -11194,7 +11250,7 @@ done_secondary:
 		}
 	}	
 
-	if (has_fired) {
+	if (has_fired && (Script_system.IsActiveAction(CHA_ONWPFIRED) || Script_system.IsActiveAction(CHA_SECONDARYFIRE))) {
 		object *objp = &Objects[shipp->objnum];
 		object* target;
 		if (Ai_info[shipp->ai_index].target_objnum != -1)
@@ -11647,6 +11703,10 @@ int wing_lookup(char *name)
 	return -1;
 }
 
+// name index for ship_info_lookup_sub(), kept in step with Num_ship_classes
+static SCP_hash_map<uint, int> Ship_info_name_index;
+static int Ship_info_name_indexed = 0;
+
 /**
  * Return the index of Ship_info[].name that is *token.
  */
@@ -11654,6 +11714,29 @@ int ship_info_lookup_sub(char *token)
 {
 	int	i;
 
+	// the table was reset since we last looked, so start over
+	if (Ship_info_name_indexed > Num_ship_classes) {
+		Ship_info_name_index.clear();
+		Ship_info_name_indexed = 0;
+	}
+
+	// pick up any classes parsed since the last lookup; on a hash collision keep the first
+	// class, which is the one the linear search would have found
+	for ( ; Ship_info_name_indexed < Num_ship_classes; Ship_info_name_indexed++) {
+		uint hash = hash_string_nocase(Ship_info[Ship_info_name_indexed].name);
+
+		if (Ship_info_name_index.find(hash) == Ship_info_name_index.end())
+			Ship_info_name_index[hash] = Ship_info_name_indexed;
+	}
+
+	SCP_hash_map<uint, int>::iterator it = Ship_info_name_index.find(hash_string_nocase(token));
+	if (it == Ship_info_name_index.end())
+		return -1;
+
+	if (!stricmp(token, Ship_info[it->second].name))
+		return it->second;
+
+	// two names share a hash, so do it the slow way
 	for (i = 0; i < Num_ship_classes; i++)
 		if (!stricmp(token, Ship_info[i].name))
 			return i;
@@ -12254,13 +12337,19 @@ ship_subsys *ship_get_indexed_subsys( ship *sp, int index, vec3d *attacker_pos )
 	}
 
 
-	count = 0;
-	ss = GET_FIRST(&sp->subsys_list);
-	while ( ss != END_OF_LIST( &sp->subsys_list ) ) {
-		if ( count == index )
-			return ss;
-		count++;
-		ss = GET_NEXT( ss );
+	SCP_vector<ship_subsys*> *array = ship_subsys_array(sp);
+	if ( (array != NULL) && !array->empty() ) {
+		if ( index < (int)array->size() )
+			return (*array)[index];
+	} else {
+		count = 0;
+		ss = GET_FIRST(&sp->subsys_list);
+		while ( ss != END_OF_LIST( &sp->subsys_list ) ) {
+			if ( count == index )
+				return ss;
+			count++;
+			ss = GET_NEXT( ss );
+		}
 	}
 
 	// get allender -- turret ref didn't fixup correctly!!!!
@@ -12285,6 +12374,17 @@ int ship_get_index_from_subsys(ship_subsys *ssp, int objnum, int error_bypass)
 
 		shipp = &Ships[Objects[objnum].instance];
 
+		SCP_vector<ship_subsys*> *array = ship_subsys_array(shipp);
+		if ( (array != NULL) && !array->empty() ) {
+			for (count = 0; count < (int)array->size(); count++) {
+				if ( (*array)[count] == ssp )
+					return count;
+			}
+			if ( !error_bypass )
+				Int3();			// get allender -- turret ref didn't fixup correctly!!!!
+			return -1;
+		}
+
 		count = 0;
 		ss = GET_FIRST(&shipp->subsys_list);
 		while ( ss != END_OF_LIST( &shipp->subsys_list ) ) {
@@ -12299,6 +12399,57 @@ int ship_get_index_from_subsys(ship_subsys *ssp, int objnum, int error_bypass)
 	}
 }
 
+/**
+ * Looks up a subsystem position by name through the ship class's name index.
+ *
+ * @return position in the ship's subsys_list, or -1 if the index can't answer and the list has to be searched
+ */
+static int ship_subsys_lookup_index(ship *sp, char *ss_name)
+{
+	int sclass = sp->ship_info_index;
+	SCP_vector<ship_subsys*> *array = ship_subsys_array(sp);
+	SCP_hash_map<uint, int>::iterator it;
+	int i;
+
+	if ( (sclass < 0) || (array == NULL) || array->empty() )
+		return -1;
+
+	if ( (int)Ship_subsys_name_index.size() <= sclass ) {
+		Ship_subsys_name_index.resize(sclass + 1);
+		Ship_subsys_name_indexed.resize(sclass + 1, false);
+	}
+
+	// ships of a class all link the same subsystems in the same order, so any one of them will do;
+	// on a hash collision keep the first, which is the one the linear search would have found
+	if ( !Ship_subsys_name_indexed[sclass] ) {
+		for (i = 0; i < (int)array->size(); i++) {
+			uint hash = hash_subsystem_name((*array)[i]->system_info->subobj_name);
+
+			if (Ship_subsys_name_index[sclass].find(hash) == Ship_subsys_name_index[sclass].end())
+				Ship_subsys_name_index[sclass][hash] = i;
+		}
+		Ship_subsys_name_indexed[sclass] = true;
+	}
+
+	it = Ship_subsys_name_index[sclass].find(hash_subsystem_name(ss_name));
+	if ( it == Ship_subsys_name_index[sclass].end() )
+		return -1;
+
+	i = it->second;
+	if ( (i < (int)array->size()) && !subsystem_stricmp((*array)[i]->system_info->subobj_name, ss_name) ) {
+#ifndef NDEBUG
+		// the linear search stops at the first match, so nothing before this one may match
+		for (int j = 0; j < i; j++) {
+			Assertion(subsystem_stricmp((*array)[j]->system_info->subobj_name, ss_name), "Subsystem name index for '%s' on ship %s disagrees with a linear search", ss_name, sp->ship_name);
+		}
+#endif
+		return i;
+	}
+
+	// two names share a hash
+	return -1;
+}
+
 /**
  * Returns the index number of the ship_subsys parameter
  */
@@ -12307,6 +12458,10 @@ int ship_get_subsys_index(ship *sp, char *ss_name, int error_bypass)
 	int count;
 	ship_subsys *ss;
 
+	count = ship_subsys_lookup_index(sp, ss_name);
+	if (count >= 0)
+		return count;
+
 	count = 0;
 	ss = GET_FIRST(&sp->subsys_list);
 	while ( ss != END_OF_LIST( &sp->subsys_list ) ) {
@@ -15310,6 +15465,9 @@ void ship_page_in()
 		nprintf(( "Paging","Found ship '%s'\n", Ships[i].ship_name ));
 		ship_class_used[Ships[i].ship_info_index]++;
 
+		// textures only need to be paged in once per class, not once per ship
+		bool first_of_class = (ship_class_used[Ships[i].ship_info_index] == 1);
+
 		// check if we are going to use a Knossos device and make sure the special warp ani gets pre-loaded
 		if ( Ship_info[Ships[i].ship_info_index].flags & SIF_KNOSSOS_DEVICE )
 			Knossos_warp_ani_used = 1;
@@ -15340,8 +15498,10 @@ void ship_page_in()
 
 		// page in all of the textures if the model is already loaded
 		if (sip->model_num >= 0) {
-			nprintf(( "Paging", "Paging in textures for ship '%s'\n", Ships[i].ship_name ));
-			model_page_in_textures(sip->model_num, Ships[i].ship_info_index);
+			if (first_of_class) {
+				nprintf(( "Paging", "Paging in textures for ship '%s'\n", Ships[i].ship_name ));
+				model_page_in_textures(sip->model_num, Ships[i].ship_info_index);
+			}
 			// need to make sure and do this again, after we are sure that all of the textures are ready
 			ship_init_afterburners( &Ships[i] );
 		}
@@ -15358,6 +15518,8 @@ void ship_page_in()
 		nprintf(( "Paging", "Found future arrival ship '%s'\n", p_objp->name ));
 		ship_class_used[p_objp->ship_class]++;
 
+		bool first_of_class = (ship_class_used[p_objp->ship_class] == 1);
+
 		// This will go through Subsys_index[] and grab all weapons: primary, secondary, and turrets
 		for (i = p_objp->subsys_index; i < (p_objp->subsys_index + p_objp->subsys_count); i++) {
 			for (j = 0; j < MAX_SHIP_PRIMARY_BANKS; j++) {
@@ -15372,7 +15534,7 @@ void ship_page_in()
 		}
 
 		// page in any replacement textures
-		if (Ship_info[p_objp->ship_class].model_num >= 0) {
+		if (first_of_class && (Ship_info[p_objp->ship_class].model_num >= 0)) {
 			nprintf(( "Paging", "Paging in textures for future arrival ship '%s'\n", p_objp->name ));
 			model_page_in_textures(Ship_info[p_objp->ship_class].model_num, p_objp->ship_class);
 		}
@@ -15942,6 +16104,11 @@ ship_subsys *ship_get_subsys(ship *shipp, char *subsys_name)
 		return NULL;
 	}
 
+	int index = ship_subsys_lookup_index(shipp, subsys_name);
+	if (index >= 0) {
+		return (*ship_subsys_array(shipp))[index];
+	}
+
 	ship_subsys *ss = GET_FIRST(&shipp->subsys_list);
 	while (ss != END_OF_LIST(&shipp->subsys_list)) {
 		// check subsystem name
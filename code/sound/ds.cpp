@@ -1312,6 +1312,11 @@ void ds_close()
 }
 
 
+// counts calls to ds_do_frame(), for channel::busy_frame
+static int Ds_frame_count = 0;
+
+MONITOR(NumChannelStateQueries)
+
 /**
  * Find a free channel to play a sound on.  If no free channels exists, free up one based on volume levels.
  *
@@ -1327,13 +1332,11 @@ int ds_get_free_channel(float new_volume, int snd_id, int priority)
 {
 	int			i, first_free_channel, limit = 100;
 	int			instance_count;	// number of instances of sound already playing
-	int			lowest_vol_index = -1, lowest_instance_vol_index = -1;
-	float		lowest_vol = 1.0f, lowest_instance_vol = 1.0f;
+	int			lowest_vol_index, lowest_instance_vol_index;
+	float		lowest_vol, lowest_instance_vol;
 	channel		*chp;
 	int status;
-
-	instance_count = 0;
-	first_free_channel = -1;
+	int trust_busy_frame = 1, used_busy_frame;
 
 	// determine the limit of concurrent instances of this sound
 	switch (priority) {
@@ -1360,48 +1363,77 @@ int ds_get_free_channel(float new_volume, int snd_id, int priority)
 	}
 
 	// Look for a channel to use to play this sample
-	for ( i = 0; i < MAX_CHANNELS; i++ ) {
-		chp = &Channels[i];
+	for ( ;; ) {
+		instance_count = 0;
+		first_free_channel = -1;
+		lowest_vol_index = -1;
+		lowest_instance_vol_index = -1;
+		lowest_vol = 1.0f;
+		lowest_instance_vol = 1.0f;
+		used_busy_frame = 0;
+
+		for ( i = 0; i < MAX_CHANNELS; i++ ) {
+			chp = &Channels[i];
+
+			// source not created yet
+			if (chp->source_id == 0) {
+				if (first_free_channel == -1) {
+					first_free_channel = i;
+				}
+				continue;
+			}
 
-		// source not created yet
-		if (chp->source_id == 0) {
-			if (first_free_channel == -1) {
-				first_free_channel = i;
+			// source not bound to a buffer
+			if (chp->sid == -1) {
+				if (first_free_channel == -1) {
+					first_free_channel = i;
+				}
+				continue;
 			}
-			continue;
-		}
 
-		// source not bound to a buffer
-		if (chp->sid == -1) {
-			if (first_free_channel == -1) {
-				first_free_channel = i;
+			// a source seen playing earlier this frame is taken to still be playing, so a burst of
+			// sounds in one frame doesn't query every source for every sound
+			if (trust_busy_frame && (chp->busy_frame == Ds_frame_count)) {
+				status = AL_PLAYING;
+				used_busy_frame = 1;
+			} else {
+				MONITOR_INC(NumChannelStateQueries, 1);
+				OpenAL_ErrorCheck( alGetSourcei(chp->source_id, AL_SOURCE_STATE, &status), continue );
 			}
-			continue;
-		}
 
-		OpenAL_ErrorCheck( alGetSourcei(chp->source_id, AL_SOURCE_STATE, &status), continue );
+			if ( (status == AL_INITIAL) || (status == AL_STOPPED) ) {
+				chp->busy_frame = -1;
+				ds_close_channel_fast(i);
 
-		if ( (status == AL_INITIAL) || (status == AL_STOPPED) ) {
-			ds_close_channel_fast(i);
+				if (first_free_channel == -1) {
+					first_free_channel = i;
+				}
+				continue;
+			} else {
+				chp->busy_frame = Ds_frame_count;
 
-			if (first_free_channel == -1) {
-				first_free_channel = i;
-			}
-			continue;
-		} else {
-			if ( chp->snd_id == snd_id ) {
-				instance_count++;
-				if ( (chp->vol < lowest_instance_vol) && (chp->looping == FALSE) ) {
-					lowest_instance_vol = chp->vol;
-					lowest_instance_vol_index = i;
+				if ( chp->snd_id == snd_id ) {
+					instance_count++;
+					if ( (chp->vol < lowest_instance_vol) && (chp->looping == FALSE) ) {
+						lowest_instance_vol = chp->vol;
+						lowest_instance_vol_index = i;
+					}
+				} else if ( chp->is_voice_msg ) {
+					// a playing voice message is not allowed to be preempted.
+				} else if ( (chp->vol < lowest_vol) && (chp->looping == FALSE) ) {
+					lowest_vol_index = i;
+					lowest_vol = chp->vol;
 				}
-			} else if ( chp->is_voice_msg ) {
-				// a playing voice message is not allowed to be preempted.
-			} else if ( (chp->vol < lowest_vol) && (chp->looping == FALSE) ) {
-				lowest_vol_index = i;
-				lowest_vol = chp->vol;
 			}
 		}
+
+		// the cached states are only good enough when they leave a free channel under the limit.
+		// before refusing the sound or stopping another one, ask OpenAL about every source
+		if ( !used_busy_frame || ((instance_count < limit) && (first_free_channel != -1)) ) {
+			break;
+		}
+
+		trust_busy_frame = 0;
 	}
 
 	// If we've exceeded the limit, then maybe stop the duplicate if it is lower volume
@@ -1509,6 +1541,7 @@ void ds_stop_easy(int sid)
 	if (cid != -1) {
 		ALuint source_id = Channels[cid].source_id;
 		OpenAL_ErrorPrint( alSourceStop(source_id) );
+		Channels[cid].busy_frame = -1;
 	}
 }
 
@@ -1676,6 +1709,7 @@ void ds_stop_channel(int channel)
 {
 	if ( Channels[channel].source_id != 0 ) {
 		OpenAL_ErrorPrint( alSourceStop(Channels[channel].source_id) );
+		Channels[channel].busy_frame = -1;
 	}
 }
 
@@ -1689,6 +1723,7 @@ void ds_stop_channel_all()
 	for ( i=0; i<MAX_CHANNELS; i++ ) {
 		if ( Channels[i].source_id != 0 ) {
 			OpenAL_ErrorPrint( alSourceStop(Channels[i].source_id) );
+			Channels[i].busy_frame = -1;
 		}
 	}
 }
@@ -2377,6 +2412,8 @@ void ds_do_frame()
 		return;
 	}
 
+	Ds_frame_count++;
+
 	int i;
 	channel *cp = NULL;
 
@@ -2270,6 +2270,26 @@ void beam_jitter_aim(beam *b, float aim)
 // BEAM COLLISION FUNCTIONS
 // -----------------------------===========================------------------------------
 
+MONITOR( NumBeamShipCulled )
+
+// returns whether the infinite line through l0 and l1 passes within radius of center
+static int beam_line_near_sphere(vec3d *l0, vec3d *l1, vec3d *center, float radius)
+{
+	vec3d nearest;
+	float dist_squared;
+
+	// can't define a line, so let the full checks sort it out
+	if (vm_vec_same(l0, l1)) {
+		return 1;
+	}
+
+	vm_vec_dist_squared_to_line(center, l0, l1, &nearest, &dist_squared);
+
+	// a little slack, so rounding never rejects something the exact tests would accept
+	radius += 1.0f;
+	return (dist_squared <= radius * radius);
+}
+
 // collide a beam with a ship, returns 1 if we can ignore all future collisions between the 2 objects
 int beam_collide_ship(obj_pair *pair)
 {
@@ -2379,9 +2399,19 @@ int beam_collide_ship(obj_pair *pair)
 	mc_hull_exit.flags |= MC_CHECK_MODEL;
 
 	// check all three kinds of collisions
-	int shield_collision = (pm->shield.ntris > 0) ? model_collide(&mc_shield) : 0;
-	int hull_enter_collision = model_collide(&mc_hull_enter);
-	int hull_exit_collision = (beam_will_tool_target(b, ship_objp)) ? model_collide(&mc_hull_exit) : 0;
+	int shield_collision = 0;
+	int hull_enter_collision = 0;
+	int hull_exit_collision = 0;
+
+	// each of those starts by testing the model's bounding sphere against the beam, running one way
+	// or the other along the same line; if the whole line misses the sphere, none of them can hit
+	if (beam_line_near_sphere(&b->last_start, &b->last_shot, &ship_objp->pos, pm->rad + ((mc.flags & MC_CHECK_SPHERELINE) ? mc.radius : 0.0f))) {
+		shield_collision = (pm->shield.ntris > 0) ? model_collide(&mc_shield) : 0;
+		hull_enter_collision = model_collide(&mc_hull_enter);
+		hull_exit_collision = (beam_will_tool_target(b, ship_objp)) ? model_collide(&mc_hull_exit) : 0;
+	} else {
+		MONITOR_INC( NumBeamShipCulled, 1 );
+	}
 
 	// check shields for impact
 	// (tooled ships are probably not going to be maintaining a shield over their exit hole,
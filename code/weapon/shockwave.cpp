@@ -306,6 +306,11 @@ void shockwave_move(object *shockwave_objp, float frametime)
 			}
 		}
 
+		// check the range first; it rejects most objects without touching the hit list
+		if ( weapon_area_calc_damage(objp, &sw->pos, sw->inner_radius, sw->outer_radius, sw->blast, sw->damage, &blast, &damage, sw->radius) == -1 ){
+			continue;
+		}
+
 		// only apply damage to a ship once from a shockwave
 		for ( i = 0; i < sw->num_objs_hit; i++ ) {
 			if ( objp->signature == sw->obj_sig_hitlist[i] ){
@@ -317,10 +322,6 @@ void shockwave_move(object *shockwave_objp, float frametime)
 			continue;
 		}
 
-		if ( weapon_area_calc_damage(objp, &sw->pos, sw->inner_radius, sw->outer_radius, sw->blast, sw->damage, &blast, &damage, sw->radius) == -1 ){
-			continue;
-		}
-
 		// okay, we have damage applied, record the object signature so we don't repeatedly apply damage
 		Assert(sw->num_objs_hit < SW_MAX_OBJS_HIT);
 		if ( sw->num_objs_hit >= SW_MAX_OBJS_HIT) {
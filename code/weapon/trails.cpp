@@ -19,11 +19,19 @@
 int Num_trails;
 trail Trails;
 
+// finished trails are kept here, linked through next, and handed out again by trail_create()
+static trail *Trail_free_list = NULL;
+
+// seconds of trail time elapsed this level; sections are aged against this when needed
+// instead of every section being updated every frame
+static float Trail_time = 0.0f;
+
 // Reset everything between levels
 void trail_level_init()
 {
 	Num_trails = 0;
 	Trails.next = &Trails;
+	Trail_time = 0.0f;
 }
 
 void trail_level_close()
@@ -37,9 +45,22 @@ void trail_level_close()
 		delete trailp;
 	}
 
+	for(trail *trailp = Trail_free_list; trailp != NULL; trailp = nextp)
+	{
+		nextp = trailp->next;
+		delete trailp;
+	}
+	Trail_free_list = NULL;
+
 	Num_trails=0;
 }
 
+// how far along its life section n is, where 1.0 means fully faded
+static inline float trail_section_val(trail *trailp, int n)
+{
+	return (Trail_time - trailp->birth[n]) / trailp->info.max_life;
+}
+
 //returns the number of a free trail
 //returns -1 if no free trails
 trail *trail_create(trail_info *info)
@@ -49,8 +70,14 @@ trail *trail_create(trail_info *info)
 	if((Game_mode & GM_STANDALONE_SERVER) || !Detail.weapon_extras)
 		return NULL;
 
-	// Make a new trail
-	trail *trailp = new trail;
+	// Make a new trail, reusing a finished one if there is one
+	trail *trailp;
+	if (Trail_free_list != NULL) {
+		trailp = Trail_free_list;
+		Trail_free_list = trailp->next;
+	} else {
+		trailp = new trail;
+	}
 
 	// increment counter
 	Num_trails++;
@@ -152,6 +179,7 @@ static void allocate_trail_verts(int num_verts)
 void trail_render( trail * trailp )
 {
 	int sections[NUM_TRAIL_SECTIONS];
+	float section_vals[NUM_TRAIL_SECTIONS];
 	int num_sections = 0;
 	int i;
 	vec3d topv, botv, *fvec, last_pos, tmp_fvec;
@@ -181,9 +209,11 @@ void trail_render( trail * trailp )
 		if (n < 0)
 			n = NUM_TRAIL_SECTIONS-1;
 
-		if (trailp->val[n] > 1.0f)
+		float val = trail_section_val(trailp, n);
+		if (val > 1.0f)
 			break;
 
+		section_vals[num_sections] = val;
 		sections[num_sections++] = n;
 	} while ( n != trailp->head );
 
@@ -210,11 +240,11 @@ void trail_render( trail * trailp )
 			init_fade_out = ((float) i) / (float) num_faded_sections;
 		}
 
-		w = trailp->val[n] * w_size + ti->w_start;
+		w = section_vals[i] * w_size + ti->w_start;
 		if (init_fade_out != 1.0f) {
-			l = (ubyte)fl2i((trailp->val[n] * a_size + ti->a_start) * 255.0f * init_fade_out * init_fade_out);
+			l = (ubyte)fl2i((section_vals[i] * a_size + ti->a_start) * 255.0f * init_fade_out * init_fade_out);
 		} else {
-			l = (ubyte)fl2i((trailp->val[n] * a_size + ti->a_start) * 255.0f);
+			l = (ubyte)fl2i((section_vals[i] * a_size + ti->a_start) * 255.0f);
 		}
 
 		if ( i == 0 )	{
@@ -325,7 +355,7 @@ void trail_add_segment( trail *trailp, vec3d *pos )
 	}
 	
 	trailp->pos[next] = *pos;
-	trailp->val[next] = 0.0f;
+	trailp->birth[next] = Trail_time;
 }		
 
 void trail_set_segment( trail *trailp, vec3d *pos )
@@ -340,36 +370,36 @@ void trail_set_segment( trail *trailp, vec3d *pos )
 
 void trail_move_all(float frametime)
 {
-	int num_alive_segments,n;
-	float time_delta;
+	int newest;
 	trail *next_trail;
 	trail *prev_trail = &Trails;
 
+	Trail_time += frametime;
+
 	for (trail *trailp = Trails.next; trailp != &Trails; trailp = next_trail) {
 		next_trail = trailp->next;
 
-		num_alive_segments = 0;
-
-		if ( trailp->tail != trailp->head )	{
-			n = trailp->tail;			
-			time_delta = frametime / trailp->info.max_life;
-			do	{
-				n--;
-				if ( n < 0 ) n = NUM_TRAIL_SECTIONS-1;
+		if ( !trailp->object_died ) {
+			prev_trail = trailp;
+			continue;
+		}
 
-				trailp->val[n] += time_delta;
+		// sections fade oldest first, so the trail is gone once its newest section is
+		bool alive = false;
 
-				if ( trailp->val[n] <= 1.0f ) {
-					num_alive_segments++;	// Record how many still alive.
-				}
+		if ( trailp->tail != trailp->head )	{
+			newest = trailp->tail - 1;
+			if ( newest < 0 ) newest = NUM_TRAIL_SECTIONS-1;
 
-			} while ( n != trailp->head );
-		}		
+			alive = (trail_section_val(trailp, newest) <= 1.0f);
+		}
 	
-		if ( (num_alive_segments < 1) && trailp->object_died)
+		if ( !alive )
 		{
 			prev_trail->next = trailp->next;
-			delete trailp;
+
+			trailp->next = Trail_free_list;
+			Trail_free_list = trailp;
 
 			// decrement counter
 			Num_trails--;
@@ -34,7 +34,7 @@ typedef struct trail_info {
 typedef struct trail {
 	int		head, tail;						// pointers into the queue for the trail points
 	vec3d	pos[NUM_TRAIL_SECTIONS];	// positions of trail points
-	float	val[NUM_TRAIL_SECTIONS];	// for each point, a value that tells how much to fade out	
+	float	birth[NUM_TRAIL_SECTIONS];	// for each point, the trail clock when it was added; its fade comes from its age
 	bool	object_died;					// set to zero as long as object	
 	int		trail_stamp;					// trail timestamp	
 
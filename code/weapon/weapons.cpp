@@ -447,6 +447,16 @@ missile_obj *missile_obj_return_address(int index)
 	return &Missile_objs[index];
 }
 
+// name index for weapon_info_lookup(), kept in step with Num_weapon_types
+static SCP_hash_map<uint, int> Weapon_info_name_index;
+static int Weapon_info_name_indexed = 0;
+
+static void weapon_info_name_index_reset()
+{
+	Weapon_info_name_index.clear();
+	Weapon_info_name_indexed = 0;
+}
+
 /**
  * Return the index of Weapon_info[].name that is *name.
  */
@@ -456,6 +466,27 @@ int weapon_info_lookup(const char *name)
 	if (name == NULL)
 		return -1;
 
+	// the table was reset since we last looked, so start over
+	if (Weapon_info_name_indexed > Num_weapon_types)
+		weapon_info_name_index_reset();
+
+	// pick up any weapons parsed since the last lookup; on a hash collision keep the first
+	// weapon, which is the one the linear search would have found
+	for ( ; Weapon_info_name_indexed < Num_weapon_types; Weapon_info_name_indexed++) {
+		uint hash = hash_string_nocase(Weapon_info[Weapon_info_name_indexed].name);
+
+		if (Weapon_info_name_index.find(hash) == Weapon_info_name_index.end())
+			Weapon_info_name_index[hash] = Weapon_info_name_indexed;
+	}
+
+	SCP_hash_map<uint, int>::iterator it = Weapon_info_name_index.find(hash_string_nocase(name));
+	if (it == Weapon_info_name_index.end())
+		return -1;
+
+	if (!stricmp(name, Weapon_info[it->second].name))
+		return it->second;
+
+	// two names share a hash, so do it the slow way
 	for (int i=0; i<Num_weapon_types; i++)
 		if (!stricmp(name, Weapon_info[i].name))
 			return i;
@@ -2983,6 +3014,8 @@ void weapon_sort_by_type()
 	for (i = 0; i < num_child_secondaries; i++, weapon_index++)
 		Weapon_info[weapon_index] = child_secondaries[i];
 
+	// every index has moved
+	weapon_info_name_index_reset();
 
 	if (lasers)			delete [] lasers;
 	if (big_lasers)		delete [] big_lasers;
@@ -3374,6 +3407,18 @@ void weapon_init()
 		// do post-parse cleanup
 		weapon_do_post_parse();
 
+#ifndef NDEBUG
+		// the name index has to give the same answer as a plain linear search
+		for (int i = 0; i < Num_weapon_types; i++) {
+			int first;
+
+			for (first = 0; stricmp(Weapon_info[first].name, Weapon_info[i].name); first++)
+				;
+
+			Assertion(weapon_info_lookup(Weapon_info[i].name) == first, "Weapon class name index disagrees with a linear search for '%s'", Weapon_info[i].name);
+		}
+#endif
+
 		Weapons_inited = 1;
 	}
 
@@ -3669,9 +3714,11 @@ void weapon_delete(object *obj)
 	weapon *wp;
 	int num;
 
-	Script_system.SetHookObjects(2, "Weapon", obj, "Self", obj);
-	Script_system.RunCondition(CHA_ONWEAPONDELETE);
-	Script_system.RemHookVars(2, "Weapon", "Self");
+	if (Script_system.IsActiveAction(CHA_ONWEAPONDELETE)) {
+		Script_system.SetHookObjects(2, "Weapon", obj, "Self", obj);
+		Script_system.RunCondition(CHA_ONWEAPONDELETE);
+		Script_system.RemHookVars(2, "Weapon", "Self");
+	}
 
 	num = obj->instance;
 
@@ -5612,6 +5659,47 @@ void weapon_do_electronics_effect(object *ship_objp, vec3d *blast_pos, int wi_in
 	}
 }
 
+MONITOR( NumAreaEffectCulled )
+
+/**
+ * Cheap test for whether an object is certainly too far from an area-effect blast to be touched by it.
+ *
+ * Uses the largest coordinate difference, which never exceeds the distance that
+ * weapon_area_calc_damage() measures with vm_vec_dist_quick(), so it never rejects anything that
+ * would have been hit.
+ */
+static int weapon_area_out_of_reach(object *objp, vec3d *pos, float reach)
+{
+	float extent, d;
+
+	if (objp->type == OBJ_SHIP) {
+		// the nearest bbox point can be at most this far from the ship's center
+		polymodel *pm = model_get(Ship_info[Ships[objp->instance].ship_info_index].model_num);
+		extent = MAX(fl_abs(pm->mins.xyz.x), fl_abs(pm->maxs.xyz.x))
+			+ MAX(fl_abs(pm->mins.xyz.y), fl_abs(pm->maxs.xyz.y))
+			+ MAX(fl_abs(pm->mins.xyz.z), fl_abs(pm->maxs.xyz.z));
+	} else {
+		extent = objp->radius;
+	}
+
+	// a little slack so float rounding in the exact test can't matter
+	reach += extent + 1.0f;
+
+	d = fl_abs(objp->pos.xyz.x - pos->xyz.x);
+	if (d > reach)
+		return 1;
+
+	d = fl_abs(objp->pos.xyz.y - pos->xyz.y);
+	if (d > reach)
+		return 1;
+
+	d = fl_abs(objp->pos.xyz.z - pos->xyz.z);
+	if (d > reach)
+		return 1;
+
+	return 0;
+}
+
 /**
  * Calculate the damage for an object based on the location of an area-effect
  * explosion.
@@ -5634,6 +5722,11 @@ int weapon_area_calc_damage(object *objp, vec3d *pos, float inner_rad, float out
 	float dist;
 	vec3d box_pt;
 
+	if ( weapon_area_out_of_reach(objp, pos, MIN(outer_rad, limit)) ) {
+		MONITOR_INC( NumAreaEffectCulled, 1 );
+		return -1;
+	}
+
 	// if object receiving the blast is a ship, use the bbox for distances
 	// otherwise use the objects radius
 	// could possibly exclude SIF_SMALL_SHIP (& other small objects) from using the bbox
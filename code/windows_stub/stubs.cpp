@@ -562,12 +562,16 @@ int vm_init(int min_heap_size)
 	return 1;
 }
 
+MONITOR( NumMallocs )
+
 #ifndef NDEBUG
 void *_vm_malloc( int size, char *filename, int line, int quiet )
 #else
 void *_vm_malloc( int size, int quiet )
 #endif
 {
+	MONITOR_INC( NumMallocs, 1 );
+
 	void *ptr = malloc( size );
 
 	if (!ptr)	{